@@ -7,8 +7,12 @@
 #include "ATOT_Solver.hpp"
 #include "ATO_OptimizationProblem.hpp"
 #include "ATO_TopoTools.hpp"
+#include "ATO_KDTree.hpp"
 #include "ATO_Types.hpp"
 
+#include <limits>
+#include <unordered_set>
+
 /* GAH FIXME - Silence warning:
 TRILINOS_DIR/../../../include/pecos_global_defs.hpp:17:0: warning: 
         "BOOST_MATH_PROMOTE_DOUBLE_POLICY" redefined [enabled by default]
@@ -19,6 +23,7 @@ Please remove when issue is resolved
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
 
+#include "Albany_ConcurrentSolves.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_StateInfoStruct.hpp"
 #include "Adapt_NodalDataVector.hpp"
@@ -131,6 +136,57 @@ ATOT::SpatialFilter::buildOperator(
       }
     }
   
+    if( neighborSearch == "All Pairs" || compareNeighborSearch ){
+      allPairsTime.start(/*reset=*/true);
+      filterOperatorT = buildOperatorAllPairs(app, overlapNodeMapT, localNodeMapT,
+                                              importerT, exporterT, excludeNodes);
+      allPairsTime.stop();
+    }
+    if( neighborSearch == "k-d Tree" || compareNeighborSearch ){
+      kdTreeTime.start(/*reset=*/true);
+      Teuchos::RCP<Tpetra_CrsMatrix> kdTreeOperatorT =
+        buildOperatorKDTree(app, localNodeMapT, excludeNodes);
+      kdTreeTime.stop();
+      if( compareNeighborSearch )
+        compareOperators(*filterOperatorT, *kdTreeOperatorT);
+      filterOperatorT = kdTreeOperatorT;
+    }
+
+    // scale filter operator so rows sum to one.
+    Teuchos::RCP<Tpetra_Vector> rowSumsT = Teuchos::rcp(new Tpetra_Vector(filterOperatorT->getRowMap()));
+    Albany::InvRowSum(rowSumsT, filterOperatorT); 
+    filterOperatorT->leftScale(*rowSumsT);  
+    
+    //IKT, FIXME: remove the following creation of filterOperatorTransposeT 
+    //once Mark Hoemmen fixes apply method with TRANS mode in Tpetra::CrsMatrix.
+    Tpetra_RowMatrixTransposer transposer(filterOperatorT);
+    filterOperatorTransposeT = transposer.createTranspose();
+
+  return;
+
+}
+
+
+/******************************************************************************/
+Teuchos::RCP<Tpetra_CrsMatrix>
+ATOT::SpatialFilter::buildOperatorAllPairs(
+             Teuchos::RCP<Albany::Application> app,
+             Teuchos::RCP<const Tpetra_Map>    overlapNodeMapT,
+             Teuchos::RCP<const Tpetra_Map>    localNodeMapT,
+             Teuchos::RCP<Tpetra_Import>       importerT,
+             Teuchos::RCP<Tpetra_Export>       exporterT,
+             const std::set<int>&              excludeNodes)
+/******************************************************************************/
+{
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+          wsElNodeID = app->getDiscretization()->getWsElNodeID();
+  
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type&
+      coords = app->getDiscretization()->getCoords();
+
+    const Albany::WorksetArray<std::string>::type& 
+      wsEBNames = app->getDiscretization()->getWsEBNames();
+
     std::map< GlobalPoint, std::set<GlobalPoint> > neighbors;
   
     double filter_radius_sqrd = filterRadius*filterRadius;
@@ -189,7 +245,7 @@ ATOT::SpatialFilter::buildOperator(
     
     // now build filter operator
     int numnonzeros = 0;
-    filterOperatorT = Teuchos::rcp(new Tpetra_CrsMatrix(localNodeMapT,numnonzeros));
+    Teuchos::RCP<Tpetra_CrsMatrix> filterOperatorT = Teuchos::rcp(new Tpetra_CrsMatrix(localNodeMapT,numnonzeros));
     for (std::map<GlobalPoint,std::set<GlobalPoint> >::iterator 
         it=neighbors.begin(); it!=neighbors.end(); ++it) { 
       GlobalPoint homeNode = it->first;
@@ -221,20 +277,202 @@ ATOT::SpatialFilter::buildOperator(
   
     filterOperatorT->fillComplete();
 
-    // scale filter operator so rows sum to one.
-    Teuchos::RCP<Tpetra_Vector> rowSumsT = Teuchos::rcp(new Tpetra_Vector(filterOperatorT->getRowMap()));
-    Albany::InvRowSum(rowSumsT, filterOperatorT); 
-    filterOperatorT->leftScale(*rowSumsT);  
-    
-    //IKT, FIXME: remove the following creation of filterOperatorTransposeT 
-    //once Mark Hoemmen fixes apply method with TRANS mode in Tpetra::CrsMatrix.
-    Tpetra_RowMatrixTransposer transposer(filterOperatorT);
-    filterOperatorTransposeT = transposer.createTranspose();
+    return filterOperatorT;
+}
 
-  return;
+/******************************************************************************/
+Teuchos::RCP<Tpetra_CrsMatrix>
+ATOT::SpatialFilter::buildOperatorKDTree(
+             Teuchos::RCP<Albany::Application> app,
+             Teuchos::RCP<const Tpetra_Map>    localNodeMapT,
+             const std::set<int>&              excludeNodes)
+/******************************************************************************/
+{
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+          wsElNodeID = app->getDiscretization()->getWsElNodeID();
+  
+    const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type&
+      coords = app->getDiscretization()->getCoords();
+
+    const Albany::WorksetArray<std::string>::type& 
+      wsEBNames = app->getDiscretization()->getWsEBNames();
+
+    size_t dimension = app->getDiscretization()->getNumDim();
+
+    // home points are the owned nodes, whose rows are built here. trial
+    // points are the nodes that may appear in a row: not excluded and in
+    // a filtered block.
+    std::vector<GlobalPoint> homePoints, trialPoints;
+    std::unordered_set<int> homeGIDs, trialGIDs;
+    size_t num_worksets = coords.size();
+    for (size_t ws=0; ws<num_worksets; ws++) {
+      bool filtered = blocks.size() == 0 ||
+        find(blocks.begin(), blocks.end(), wsEBNames[ws]) != blocks.end();
+      size_t num_cells = coords[ws].size();
+      for (size_t cell=0; cell<num_cells; cell++) {
+        size_t num_nodes = coords[ws][cell].size();
+        for (size_t node=0; node<num_nodes; node++) {
+          GlobalPoint point;
+          point.gid = wsElNodeID[ws][cell][node];
+          for (size_t dim=0; dim<3; dim++)
+            point.coords[dim] = (dim<dimension) ? coords[ws][cell][node][dim] : 0.0;
+          if( localNodeMapT->isNodeGlobalElement(point.gid) &&
+              homeGIDs.insert(point.gid).second )
+            homePoints.push_back(point);
+          if( filtered && excludeNodes.find(point.gid) == excludeNodes.end() &&
+              trialGIDs.insert(point.gid).second )
+            trialPoints.push_back(point);
+        }
+      }
+    }
+
+    // Halo exchange: the neighbors of the owned nodes lie in their bounding
+    // box grown by the filter radius. Every process sends to every other
+    // one its trial points inside the other's box.
+    int numProcs, myRank;
+    MPI_Comm_size(MPI_COMM_WORLD, &numProcs);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
+
+    const double big = std::numeric_limits<double>::max();
+    double box[6] = {big, big, big, -big, -big, -big};
+    for (size_t i=0; i<homePoints.size(); i++) {
+      if( excludeNodes.find(homePoints[i].gid) != excludeNodes.end() ) continue;
+      for (int dim=0; dim<3; dim++) {
+        box[dim]   = std::min(box[dim],   homePoints[i].coords[dim] - filterRadius);
+        box[dim+3] = std::max(box[dim+3], homePoints[i].coords[dim] + filterRadius);
+      }
+    }
+    std::vector<double> boxes(6*numProcs);
+    MPI_Allgather(box, 6, MPI_DOUBLE, &boxes[0], 6, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    std::vector<int> sendCounts(numProcs,0), recvCounts(numProcs,0);
+    std::vector<int> sendOffsets(numProcs+1,0), recvOffsets(numProcs+1,0);
+    std::vector<GlobalPoint> sendPoints;
+    for (int proc=0; proc<numProcs; proc++) {
+      if( proc != myRank ){
+        const double* procBox = &boxes[6*proc];
+        for (size_t i=0; i<trialPoints.size(); i++) {
+          const double* x = trialPoints[i].coords;
+          if( x[0] >= procBox[0] && x[0] <= procBox[3] &&
+              x[1] >= procBox[1] && x[1] <= procBox[4] &&
+              x[2] >= procBox[2] && x[2] <= procBox[5] ) {
+            sendPoints.push_back(trialPoints[i]);
+            sendCounts[proc]++;
+          }
+        }
+      }
+      sendOffsets[proc+1] = sendOffsets[proc] + sendCounts[proc];
+    }
+    MPI_Alltoall(&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, MPI_COMM_WORLD);
+    for (int proc=0; proc<numProcs; proc++)
+      recvOffsets[proc+1] = recvOffsets[proc] + recvCounts[proc];
+
+    std::vector<GlobalPoint> recvPoints(recvOffsets[numProcs]);
+    MPI_Alltoallv(sendPoints.data(), &sendCounts[0], &sendOffsets[0], MPI_GlobalPointT,
+                  recvPoints.data(), &recvCounts[0], &recvOffsets[0], MPI_GlobalPointT,
+                  MPI_COMM_WORLD);
+    for (size_t i=0; i<recvPoints.size(); i++)
+      if( trialGIDs.insert(recvPoints[i].gid).second )
+        trialPoints.push_back(recvPoints[i]);
+
+    // radius search for each owned node
+    std::vector<double> trialCoords(dimension*trialPoints.size());
+    for (size_t i=0; i<trialPoints.size(); i++)
+      for (size_t dim=0; dim<dimension; dim++)
+        trialCoords[dimension*i+dim] = trialPoints[i].coords[dim];
+    ATO::KDTree tree(trialCoords, dimension);
+
+    size_t numRows = localNodeMapT->getNodeNumElements();
+    Teuchos::ArrayRCP<size_t> numEntriesPerRow(numRows, 0);
+    std::vector<std::vector<std::pair<Tpetra_GO,ST> > > rows(numRows);
+    std::vector<int> found;
+    for (size_t i=0; i<homePoints.size(); i++) {
+      const GlobalPoint& homeNode = homePoints[i];
+      std::vector<std::pair<Tpetra_GO,ST> >& row =
+        rows[localNodeMapT->getLocalElement(homeNode.gid)];
+      found.clear();
+      if( excludeNodes.find(homeNode.gid) == excludeNodes.end() )
+        tree.radiusSearch(homeNode.coords, filterRadius, found);
+      for (size_t j=0; j<found.size(); j++) {
+        const GlobalPoint& neighbor = trialPoints[found[j]];
+        double distance = 0.0;
+        for (size_t dim=0; dim<dimension; dim++)
+          distance += (neighbor.coords[dim]-homeNode.coords[dim])*(neighbor.coords[dim]-homeNode.coords[dim]);
+        distance = (distance > 0.0) ? sqrt(distance) : 0.0;
+        row.push_back(std::make_pair(Tpetra_GO(neighbor.gid), filterRadius - distance));
+      }
+      // if the list of connected nodes is empty, still add a one on the diagonal.
+      if( row.empty() )
+        row.push_back(std::make_pair(Tpetra_GO(homeNode.gid), 1.0));
+      std::sort(row.begin(), row.end());
+      numEntriesPerRow[localNodeMapT->getLocalElement(homeNode.gid)] = row.size();
+    }
 
+    Teuchos::RCP<Tpetra_CrsMatrix> filterOperatorT =
+      Teuchos::rcp(new Tpetra_CrsMatrix(localNodeMapT, numEntriesPerRow, Tpetra::StaticProfile));
+    std::vector<Tpetra_GO> cols;
+    std::vector<ST> vals;
+    for (size_t lid=0; lid<numRows; lid++) {
+      cols.clear(); vals.clear();
+      for (size_t j=0; j<rows[lid].size(); j++) {
+        cols.push_back(rows[lid][j].first);
+        vals.push_back(rows[lid][j].second);
+      }
+      if( cols.size() > 0 )
+        filterOperatorT->insertGlobalValues(localNodeMapT->getGlobalElement(lid),
+          Teuchos::arrayViewFromVector(cols), Teuchos::arrayViewFromVector(vals));
+    }
+    filterOperatorT->fillComplete();
+
+    return filterOperatorT;
 }
 
+/******************************************************************************/
+void
+ATOT::SpatialFilter::compareOperators(const Tpetra_CrsMatrix& allPairsOperatorT,
+                                      const Tpetra_CrsMatrix& kdTreeOperatorT)
+/******************************************************************************/
+{
+  // Entries missing from one of the operators count as zeros: the all
+  // pairs search may add zero weights for points at the filter radius.
+  const Tpetra_Map& rowMapT = *kdTreeOperatorT.getRowMap();
+  double maxDifference = 0.0;
+  Teuchos::Array<Tpetra_GO> cols;
+  Teuchos::Array<ST> vals;
+  size_t numEntries;
+  for (size_t lid=0; lid<rowMapT.getNodeNumElements(); lid++) {
+    Tpetra_GO gid = rowMapT.getGlobalElement(lid);
+    std::map<Tpetra_GO,ST> difference;
+    cols.resize(allPairsOperatorT.getNumEntriesInGlobalRow(gid));
+    vals.resize(cols.size());
+    allPairsOperatorT.getGlobalRowCopy(gid, cols(), vals(), numEntries);
+    for (size_t j=0; j<numEntries; j++) difference[cols[j]] += vals[j];
+    cols.resize(kdTreeOperatorT.getNumEntriesInGlobalRow(gid));
+    vals.resize(cols.size());
+    kdTreeOperatorT.getGlobalRowCopy(gid, cols(), vals(), numEntries);
+    for (size_t j=0; j<numEntries; j++) difference[cols[j]] -= vals[j];
+    for (std::map<Tpetra_GO,ST>::iterator it=difference.begin(); it!=difference.end(); ++it)
+      maxDifference = std::max(maxDifference, std::abs(it->second));
+  }
+  double globalMaxDifference = 0.0;
+  Teuchos::reduceAll(*rowMapT.getComm(), Teuchos::REDUCE_MAX, 1, &maxDifference, &globalMaxDifference);
+
+  double allPairsSeconds = allPairsTime.totalElapsedTime();
+  double kdTreeSeconds = kdTreeTime.totalElapsedTime();
+  double globalSeconds[2];
+  double localSeconds[2] = {allPairsSeconds, kdTreeSeconds};
+  Teuchos::reduceAll(*rowMapT.getComm(), Teuchos::REDUCE_MAX, 2, localSeconds, globalSeconds);
+  if( rowMapT.getComm()->getRank() == 0 ){
+    std::cout << "Spatial filter build: all pairs search " << globalSeconds[0]
+              << " s, k-d tree search " << globalSeconds[1]
+              << " s, max difference " << globalMaxDifference << std::endl;
+  }
+
+  TEUCHOS_TEST_FOR_EXCEPTION( globalMaxDifference > 1.0e-12*filterRadius,
+    std::runtime_error, std::endl
+    << "Error!  Spatial filter operators of the all pairs and the k-d tree "
+    << "searches differ by " << globalMaxDifference << std::endl);
+}
 
 /******************************************************************************/
 ATOT::SpatialFilter::SpatialFilter( Teuchos::ParameterList& params )
@@ -252,6 +490,14 @@ ATOT::SpatialFilter::SpatialFilter( Teuchos::ParameterList& params )
   } else
     iterations = 1;
 
+  neighborSearch = params.get<std::string>("Neighbor Search", "k-d Tree");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    neighborSearch != "k-d Tree" && neighborSearch != "All Pairs",
+    Teuchos::Exceptions::InvalidParameter, std::endl
+    << "Error!  Unknown Neighbor Search '" << neighborSearch
+    << "'.  Options are 'k-d Tree' and 'All Pairs'." << std::endl);
+  compareNeighborSearch = params.get<bool>("Compare Neighbor Search", false);
+
 }
 
 /******************************************************************************/
@@ -503,6 +749,17 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
   // Validate Problem parameters
   Teuchos::ParameterList& problemParams = appParams->sublist("Problem");
   _numPhysics = problemParams.get<int>("Number of Subproblems", 1);
+  _concurrentSubproblems = problemParams.get<bool>("Concurrent Subproblems", false);
+  _concurrentReady = false;
+  if( _concurrentSubproblems ){
+    std::string reason = Albany::concurrentSolvesUnavailable();
+    if( !reason.empty() ){
+      if( comm->getRank() == 0 )
+        std::cout << "Warning: Concurrent Subproblems disabled, " << reason
+                  << ".  Solving the subproblems serially." << std::endl;
+      _concurrentSubproblems = false;
+    }
+  }
 
   int numHomogProblems = problemParams.get<int>("Number of Homogenization Problems", 0);
   _homogenizationSets.resize(numHomogProblems);
@@ -628,7 +885,11 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
   for(int i=0; i<_numPhysics; i++){
 
     _subProblemAppParams[i] = createInputFile(appParams, i);
-    _subProblems[i] = CreateSubSolver( _subProblemAppParams[i], _solverComm);
+    // Concurrent solves run collectives of different sub problems at the
+    // same time, so each sub problem but the first needs its own communicator.
+    Teuchos::RCP<const Teuchos_Comm> subComm =
+      (_concurrentSubproblems && i > 0) ? _solverComm->duplicate() : _solverComm;
+    _subProblems[i] = CreateSubSolver( _subProblemAppParams[i], subComm);
 
     // ensure that all subproblems are topology based (i.e., optimizable)
     Teuchos::RCP<Albany::AbstractProblem> problem = _subProblems[i].app->getProblem();
@@ -816,6 +1077,8 @@ ATOT::Solver::zeroSet()
 
   _is_verbose = false;
   _is_restart = false;
+  _concurrentSubproblems = false;
+  _concurrentReady = false;
 
   _derivativeFilter   = Teuchos::null;
   _objAggregator      = Teuchos::null;
@@ -1023,18 +1286,11 @@ ATOT::Solver::InitializeOptDofs(double* p)
 
 /******************************************************************************/
 void
-ATOT::Solver::ComputeObjective(const double* p, double& g, double* dgdp)
+ATOT::Solver::solveSubProblems(const double* p)
 /******************************************************************************/
 {
-#ifdef OUTPUT_TO_SCREEN
-  std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
-#endif
-  Teuchos::RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
-  *out << "IKT, 12/22/16, WARNING: Tpetra-converted ComputeObjective has not been tested " 
-       << "yet and may not work correctly! \n"; 
+  // copy data from p into each stateManager
   for(int i=0; i<_numPhysics; i++){
-
-    // copy data from p into each stateManager
     if( entityType == "State Variable" ){
       Albany::StateManager& stateMgr = _subProblems[i].app->getStateMgr();
       copyTopologyIntoStateMgr( p, stateMgr );
@@ -1042,11 +1298,38 @@ ATOT::Solver::ComputeObjective(const double* p, double& g, double* dgdp)
     if( entityType == "Distributed Parameter"){
       copyTopologyIntoParameter( p, _subProblems[i] );
     }
+  }
 
-    // enforce PDE constraints
+  // enforce PDE constraints.  The load cases only share the topology, which
+  // was copied above, so they can be solved at the same time.  The first
+  // solve is serial so that the Teuchos timers exist before they are
+  // paused for the concurrent ones.
+  auto solve = [&](int i) {
     _subProblems[i].modelT->evalModel((*_subProblems[i].params_inT),
                                       (*_subProblems[i].responses_outT));
+  };
+
+  if( _concurrentSubproblems && _concurrentReady ){
+    Albany::runConcurrentSolves(_numPhysics, solve);
+  } else {
+    for(int i=0; i<_numPhysics; i++)
+      solve(i);
+    _concurrentReady = true;
   }
+}
+
+/******************************************************************************/
+void
+ATOT::Solver::ComputeObjective(const double* p, double& g, double* dgdp)
+/******************************************************************************/
+{
+#ifdef OUTPUT_TO_SCREEN
+  std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
+#endif
+  Teuchos::RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
+  *out << "IKT, 12/22/16, WARNING: Tpetra-converted ComputeObjective has not been tested " 
+       << "yet and may not work correctly! \n"; 
+  solveSubProblems(p);
 
   if ( entityType == "Distributed Parameter" ) {
     _objAggregator->SetInputVariablesT(_subProblems, responseMapT, responseDerivMapT);
@@ -1071,22 +1354,7 @@ ATOT::Solver::ComputeObjective(double* p, double& g, double* dgdp)
        << "yet and may not work correctly! \n"; 
   if(_iteration!=1) smoothTopologyT(p);
 
-  for(int i=0; i<_numPhysics; i++){
-    
-
-    // copy data from p into each stateManager
-    if( entityType == "State Variable" ){
-      Albany::StateManager& stateMgr = _subProblems[i].app->getStateMgr();
-      copyTopologyIntoStateMgr( p, stateMgr );
-    } else 
-    if( entityType == "Distributed Parameter"){
-      copyTopologyIntoParameter( p, _subProblems[i] );
-    }
-
-    // enforce PDE constraints
-    _subProblems[i].modelT->evalModel((*_subProblems[i].params_inT),
-                                      (*_subProblems[i].responses_outT));
-  }
+  solveSubProblems(p);
 
   if ( entityType == "Distributed Parameter" ) {
     _objAggregator->SetInputVariablesT(_subProblems, responseMapT, responseDerivMapT);
@@ -1623,21 +1891,7 @@ ATOT::Solver::Compute(const double* p, double& g, double* dgdp, double& c, doubl
 #ifdef OUTPUT_TO_SCREEN
   std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
 #endif
-  for(int i=0; i<_numPhysics; i++){
-
-    // copy data from p into each stateManager
-    if( entityType == "State Variable" ){
-      Albany::StateManager& stateMgr = _subProblems[i].app->getStateMgr();
-      copyTopologyIntoStateMgr( p, stateMgr );
-    } else 
-    if( entityType == "Distributed Parameter"){
-      copyTopologyIntoParameter( p, _subProblems[i] );
-    }
-
-    // enforce PDE constraints
-    _subProblems[i].modelT->evalModel((*_subProblems[i].params_inT),
-                                      (*_subProblems[i].responses_outT));
-  }
+  solveSubProblems(p);
 
   if ( entityType == "Distributed Parameter" ) {
     _objAggregator->SetInputVariablesT(_subProblems, responseMapT, responseDerivMapT);
@@ -2022,11 +2276,16 @@ ATOT::Solver::createInputFile( const Teuchos::RCP<Teuchos::ParameterList>& appPa
   Teuchos::ParameterList& physics_discList = physics_appParams->sublist("Discretization", false);
   physics_discList.setParameters(discList);
   // find the output file name and append "Physics_n_" to it. This only checks for exodus output.
+  // Concurrent sub problems write their files from their own threads; the
+  // STK discretization serializes all Ioss and NetCDF calls through
+  // Albany::fileIoMutex(), and asynchronous output is turned off for them.
   if( physics_discList.isType<std::string>("Exodus Output File Name") ){
     std::stringstream newname;
     newname << "physics_" << physIndex << "_" 
             << physics_discList.get<std::string>("Exodus Output File Name");
     physics_discList.set("Exodus Output File Name",newname.str());
+    if( _concurrentSubproblems )
+      physics_discList.set("Asynchronous Exodus Output", false);
   }
 
   int ntopos = _topologyInfoStructsT.size();
@@ -2233,6 +2492,7 @@ ATOT::Solver::getValidProblemParameters() const
 
   // Basic set-up
   validPL->set<int>("Number of Subproblems", 1, "Number of PDE constraint problems");
+  validPL->set<bool>("Concurrent Subproblems", false, "Solve the PDE constraint problems on one thread each");
   validPL->set<int>("Number of Homogenization Problems", 0, "Number of homogenization problems");
   validPL->set<bool>("Verbose Output", false, "Enable detailed output mode");
   validPL->set<int>("Design Output Frequency", 0, "Write isosurface every N iterations");
@@ -17,7 +17,8 @@
 #include "ATO_Types.hpp"
 #include "ATOT_Aggregator.hpp"
 #include "ATOT_Optimizer.hpp"
-#include "Petra_Converters.hpp" 
+#include "Petra_Converters.hpp"
+#include "Teuchos_Time.hpp" 
 
 namespace ATO {
   
@@ -57,6 +58,20 @@ namespace ATOT {
       Teuchos::RCP<Tpetra_CrsMatrix> FilterOperatorTransposeT(){return filterOperatorTransposeT;}
       int getNumIterations(){return iterations;}
     protected:
+      Teuchos::RCP<Tpetra_CrsMatrix> buildOperatorAllPairs(
+             Teuchos::RCP<Albany::Application> app,
+             Teuchos::RCP<const Tpetra_Map>    overlapNodeMapT,
+             Teuchos::RCP<const Tpetra_Map>    localNodeMapT,
+             Teuchos::RCP<Tpetra_Import>       importerT,
+             Teuchos::RCP<Tpetra_Export>       exporterT,
+             const std::set<int>&              excludeNodes);
+      Teuchos::RCP<Tpetra_CrsMatrix> buildOperatorKDTree(
+             Teuchos::RCP<Albany::Application> app,
+             Teuchos::RCP<const Tpetra_Map>    localNodeMapT,
+             const std::set<int>&              excludeNodes);
+      void compareOperators(
+             const Tpetra_CrsMatrix& allPairsOperatorT,
+             const Tpetra_CrsMatrix& kdTreeOperatorT);
       void importNeighbors(
              std::map< GlobalPoint, std::set<GlobalPoint> >& neighbors,
              Teuchos::RCP<Tpetra_Import>       importerT, 
@@ -71,6 +86,12 @@ namespace ATOT {
       int iterations;
       double filterRadius;
       Teuchos::Array<std::string> blocks;
+      // "k-d Tree" or "All Pairs"
+      std::string neighborSearch;
+      // build the operator with both searches, and check they agree
+      bool compareNeighborSearch;
+      Teuchos::Time allPairsTime{"ATO Filter: All Pairs Search"};
+      Teuchos::Time kdTreeTime{"ATO Filter: k-d Tree Search"};
   };
 
   class OptInterface {
@@ -160,6 +181,8 @@ Teuchos::RCP<Tpetra_LocalMap> _tpetra_response_map;
 Teuchos::RCP<const Tpetra_Map>      _tpetra_x_map;
 
 int _numPhysics; // number of sub problems
+bool _concurrentSubproblems; // solve the sub problems on one thread each
+bool _concurrentReady;       // the sub problems have been solved serially once
 
 std::vector<int> _wsOffset;  //index offsets to map to/from workset to/from 1D array.
 
@@ -237,6 +260,7 @@ void smoothTopologyT(double* p);
 void smoothTopologyT(Teuchos::RCP<TopologyInfoStructT> topoStructT);
 void copyTopologyFromStateMgr(double* p, Albany::StateManager& stateMgr );
 void copyTopologyIntoParameter(const double* p, SolverSubSolver& sub);
+void solveSubProblems(const double* p);
 void copyObjectiveFromStateMgr( double& g, double* dgdp );
 void copyConstraintFromStateMgr( double& c, double* dcdp );
 void zeroSet();
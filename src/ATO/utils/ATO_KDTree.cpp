@@ -0,0 +1,82 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "ATO_KDTree.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+// Ranges this small are searched point by point
+const int leafSize = 8;
+}
+
+/******************************************************************************/
+ATO::KDTree::KDTree(const std::vector<double>& coords_, int dim_) :
+  coords(coords_), dim(dim_), perm(coords_.size()/dim_)
+/******************************************************************************/
+{
+  std::iota(perm.begin(), perm.end(), 0);
+  build(0, perm.size(), 0);
+}
+
+/******************************************************************************/
+void
+ATO::KDTree::build(int begin, int end, int depth)
+/******************************************************************************/
+{
+  if( end - begin <= leafSize ) return;
+
+  int axis = depth % dim;
+  int mid = begin + (end - begin)/2;
+  std::nth_element(perm.begin()+begin, perm.begin()+mid, perm.begin()+end,
+    [&](int a, int b){ return point(a)[axis] < point(b)[axis]; });
+
+  build(begin, mid, depth+1);
+  build(mid+1, end, depth+1);
+}
+
+/******************************************************************************/
+void
+ATO::KDTree::radiusSearch(const double* x, double radius,
+                          std::vector<int>& result) const
+/******************************************************************************/
+{
+  search(0, perm.size(), 0, x, radius, radius*radius, result);
+}
+
+/******************************************************************************/
+void
+ATO::KDTree::search(int begin, int end, int depth, const double* x,
+                    double radius, double radius_sqrd,
+                    std::vector<int>& result) const
+/******************************************************************************/
+{
+  if( end - begin <= leafSize ){
+    for(int k=begin; k<end; k++){
+      const double* p = point(perm[k]);
+      double distance_sqrd = 0.0;
+      for(int i=0; i<dim; i++)
+        distance_sqrd += (p[i]-x[i])*(p[i]-x[i]);
+      if( distance_sqrd <= radius_sqrd ) result.push_back(perm[k]);
+    }
+    return;
+  }
+
+  int axis = depth % dim;
+  int mid = begin + (end - begin)/2;
+  const double* p = point(perm[mid]);
+
+  double distance_sqrd = 0.0;
+  for(int i=0; i<dim; i++)
+    distance_sqrd += (p[i]-x[i])*(p[i]-x[i]);
+  if( distance_sqrd <= radius_sqrd ) result.push_back(perm[mid]);
+
+  if( x[axis] - radius <= p[axis] )
+    search(begin, mid, depth+1, x, radius, radius_sqrd, result);
+  if( x[axis] + radius >= p[axis] )
+    search(mid+1, end, depth+1, x, radius, radius_sqrd, result);
+}
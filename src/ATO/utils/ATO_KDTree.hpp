@@ -0,0 +1,48 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ATO_KDTREE_HPP
+#define ATO_KDTREE_HPP
+
+#include <vector>
+
+namespace ATO {
+
+/** \brief Balanced k-d tree over a fixed set of points, for radius searches
+
+    The tree is stored implicitly in a permutation of the points: the
+    point in the middle of a range splits it along one coordinate, the
+    lower half of the range holding the points on the low side.
+*/
+class KDTree
+{
+public:
+  //! coords holds dim (1 to 3) interleaved coordinates per point
+  KDTree(const std::vector<double>& coords, int dim);
+
+  //! Indices of the points at distance <= radius from x, appended to
+  //! result in no particular order
+  void radiusSearch(const double* x, double radius,
+                    std::vector<int>& result) const;
+
+  int size() const {return perm.size();}
+
+private:
+  void build(int begin, int end, int depth);
+  void search(int begin, int end, int depth, const double* x,
+              double radius, double radius_sqrd,
+              std::vector<int>& result) const;
+
+  const double* point(int i) const {return &coords[dim*i];}
+
+  std::vector<double> coords;
+  int dim;
+  std::vector<int> perm;
+};
+
+}
+
+#endif
@@ -7,11 +7,15 @@
 
 #include "Albany_Application.hpp"
 #include "AAdapt_RC_Manager.hpp"
+#include "Albany_BlockJacobiPreconditionerT.hpp"
+#include "Albany_FrozenElements.hpp"
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_ResponseFactory.hpp"
 #include "Albany_Utils.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 #include "Teuchos_TimeMonitor.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "EpetraExt_MultiVectorOut.h"
@@ -22,7 +26,12 @@
 #endif
 
 #include "Albany_DataTypes.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <string>
+#include <type_traits>
 
 #include "Albany_DummyParameterAccessor.hpp"
 
@@ -681,6 +690,11 @@ void Albany::Application::buildProblem() {
   neq = problem->numEquations();
   spatial_dimension = problem->spatialDimension();
 
+  // The fill clones register their states like fm does, so they must be
+  // built before finalSetUp allocates the state arrays.
+  num_fill_threads_ = problemParams->get("Fill Threads", 1);
+  setupThreadedFill();
+
   // Construct responses
   // This really needs to happen after the discretization is created for
   // distributed responses, but currently it can't be moved because there
@@ -872,6 +886,42 @@ void Albany::Application::finalSetUp(
   ignore_residual_in_jacobian =
       problemParams->get("Ignore Residual In Jacobian", false);
 
+  cache_basis_functions_ = problemParams->get("Cache Basis Functions", false);
+  cache_jacobian_offsets_ = problemParams->get("Cache Jacobian Offsets", false);
+  reuse_linear_jacobian_ = problemParams->get("Linear Jacobian Reuse", false);
+  if (reuse_linear_jacobian_) {
+    // Residuals from the stored operators skip the evaluators, so the states
+    // they save at the quadrature points would not follow the solution.
+    for (auto const &state : *stateMgr.getStateInfoStruct())
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          state->entity == Albany::StateStruct::QuadPoint, std::logic_error,
+          "Linear Jacobian Reuse cannot be used with the state '"
+              << state->name << "' saved at the quadrature points\n");
+  }
+  linear_time_dependent_ =
+      problemParams->get("Linear Problem Time Dependent", false);
+
+  profile_evaluators_ = problemParams->get("Profile Evaluators", false);
+  if (profile_evaluators_) {
+    util::PerformanceContext::instance().evaluatorMonitor().setJSONFile(
+        problemParams->get<std::string>("Evaluator Profile File",
+                                        "evaluator_profile.json"));
+  }
+
+  if (problemParams->get("Frozen Element Jacobians", false)) {
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true, std::logic_error,
+        "Frozen Element Jacobians is not available with the Kokkos scatter\n");
+#endif
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        num_fill_threads_ > 1, std::logic_error,
+        "Frozen Element Jacobians cannot be combined with Fill Threads > 1\n");
+    frozen_elements_ = Teuchos::rcp(new Albany::FrozenElements(
+        problemParams->get("Frozen Element Tolerance", 1.0e-6),
+        problemParams->get("Frozen Element Requires Flag", true)));
+  }
+
   perturbBetaForDirichlets = problemParams->get("Perturb Dirichlet", 0.0);
 
   is_adjoint = problemParams->get("Solve Adjoint", false);
@@ -967,6 +1017,8 @@ RCP<const Tpetra_CrsGraph> Albany::Application::getJacobianGraphT() const {
 }
 
 RCP<Tpetra_Operator> Albany::Application::getPreconditionerT() {
+  if (precType == "Block Jacobi")
+    return rcp(new Albany::BlockJacobiPreconditionerT(disc));
 //#if defined(ATO_USES_COGENT)
 #ifdef ALBANY_ATO
   if (precType == "XFEM") {
@@ -1235,8 +1287,371 @@ void checkDerivatives(Albany::Application &app, const double time,
     ++ctr;
   }
 }
+
+// Copy the values of src into dst. Both matrices must have the same graph.
+void copyMatrixValues(Tpetra_CrsMatrix const &src, Tpetra_CrsMatrix &dst) {
+  Teuchos::ArrayView<const LO> indices;
+  Teuchos::ArrayView<const ST> values;
+  LO const num_rows = src.getNodeNumRows();
+  for (LO row = 0; row < num_rows; ++row) {
+    src.getLocalRowView(row, indices, values);
+    dst.replaceLocalValues(row, indices, values);
+  }
+}
 } // namespace
 
+void Albany::Application::setupThreadedFill() {
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      num_fill_threads_ < 1, Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error in Albany::Application: "
+          << "Fill Threads must be >= 1, not " << num_fill_threads_
+          << std::endl);
+
+  fm_clones_.clear();
+  ws_colors_.clear();
+
+  if (num_fill_threads_ == 1)
+    return;
+
+#if !defined(HAVE_TEUCHOS_THREAD_SAFE)
+  // The fill threads share RCPs to the workset vectors and the
+  // discretization, so the reference counts must be atomic.
+  *out << "Warning in Albany::Application: Fill Threads > 1 requires "
+       << "Trilinos configured with Teuchos_ENABLE_THREAD_SAFE=ON. "
+       << "Using the serial fill." << std::endl;
+  num_fill_threads_ = 1;
+  return;
+#endif
+
+  // The evaluators launch Kokkos and Intrepid2 kernels, so the fill threads
+  // have to be masters of Kokkos::OpenMP partitions rather than threads
+  // unknown to Kokkos.
+#if defined(KOKKOS_HAVE_OPENMP)
+  bool const openmp_device =
+      std::is_same<PHX::Device::execution_space, Kokkos::OpenMP>::value;
+#else
+  bool const openmp_device = false;
+#endif
+  if (!openmp_device) {
+    *out << "Warning in Albany::Application: Fill Threads > 1 requires "
+         << "the Kokkos OpenMP execution space for Phalanx. "
+         << "Using the serial fill." << std::endl;
+    num_fill_threads_ = 1;
+    return;
+  }
+
+  auto const &problem_fm = problem->getFieldManager();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      problem_fm.size() != meshSpecs.size(), std::logic_error,
+      "Error in Albany::Application: threaded fill needs one field manager "
+      "per mesh specification.\n");
+
+  // Every fill thread but the first gets its own copy of the evaluators,
+  // since evaluators keep per-evaluation data in their MDFields.
+  fm_clones_.resize(num_fill_threads_ - 1);
+  for (int thread = 0; thread < fm_clones_.size(); ++thread) {
+    fm_clones_[thread].resize(problem_fm.size());
+    for (int ps = 0; ps < problem_fm.size(); ++ps) {
+      fm_clones_[thread][ps] =
+          Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
+      problem->buildEvaluators(*fm_clones_[thread][ps], *meshSpecs[ps],
+                               stateMgr, BUILD_RESID_FM, Teuchos::null);
+    }
+  }
+
+  *out << "Albany::Application: threaded fill using " << num_fill_threads_
+       << " threads" << std::endl;
+}
+
+void Albany::Application::computeWorksetColoring() {
+  const auto &wsElNodeEqID = disc->getWsElNodeEqID();
+  int const numWorksets = wsElNodeEqID.size();
+
+  std::size_t num_cells = 0;
+  for (int ws = 0; ws < numWorksets; ++ws)
+    num_cells += wsElNodeEqID[ws].dimension(0);
+
+  int num_colored = 0;
+  for (int color = 0; color < ws_colors_.size(); ++color)
+    num_colored += ws_colors_[color].size();
+
+  // Recolor only if the worksets changed, e.g. after remeshing.
+  if (num_colored == numWorksets && num_cells == ws_colors_num_cells_)
+    return;
+
+  // Greedy coloring. Bit c of dof_colors[lid] is set if a workset of
+  // color c touches the overlapped DOF lid.
+  int const max_colors = 64;
+  std::size_t const num_dofs = disc->getOverlapMapT()->getNodeNumElements();
+  std::vector<std::uint64_t> dof_colors(num_dofs, 0);
+  Teuchos::Array<Teuchos::Array<int>> colors(max_colors);
+  Teuchos::Array<int> uncolored;
+
+  for (int ws = 0; ws < numWorksets; ++ws) {
+    auto const &conn = wsElNodeEqID[ws];
+    std::uint64_t taken = 0;
+    for (int cell = 0; cell < conn.dimension(0); ++cell)
+      for (int node = 0; node < conn.dimension(1); ++node)
+        for (int eq = 0; eq < conn.dimension(2); ++eq)
+          taken |= dof_colors[conn(cell, node, eq)];
+
+    int color = 0;
+    while (color < max_colors && ((taken >> color) & 1) != 0)
+      ++color;
+
+    if (color == max_colors) {
+      uncolored.push_back(ws);
+      continue;
+    }
+
+    std::uint64_t const bit = std::uint64_t(1) << color;
+    for (int cell = 0; cell < conn.dimension(0); ++cell)
+      for (int node = 0; node < conn.dimension(1); ++node)
+        for (int eq = 0; eq < conn.dimension(2); ++eq)
+          dof_colors[conn(cell, node, eq)] |= bit;
+    colors[color].push_back(ws);
+  }
+
+  ws_colors_.clear();
+  for (int color = 0; color < max_colors; ++color)
+    if (colors[color].size() > 0)
+      ws_colors_.push_back(colors[color]);
+  // Worksets that could not be colored are evaluated one at a time.
+  for (int i = 0; i < uncolored.size(); ++i)
+    ws_colors_.push_back(Teuchos::Array<int>(1, uncolored[i]));
+
+  ws_colors_num_cells_ = num_cells;
+
+  *out << "Albany::Application: " << numWorksets << " worksets in "
+       << ws_colors_.size() << " colors for threaded fill" << std::endl;
+}
+
+template <typename EvalT>
+void Albany::Application::evaluateWorksetsThreaded(
+    PHAL::Workset const &workset) {
+  computeWorksetColoring();
+
+  const auto &wsPhysIndex = disc->getWsPhysIndex();
+
+  for (int color = 0; color < ws_colors_.size(); ++color) {
+    Teuchos::Array<int> const &ws_of_color = ws_colors_[color];
+    int const num_ws = ws_of_color.size();
+
+    // Load the workset data on this thread so that the fill threads only
+    // run the evaluators.
+    std::vector<PHAL::Workset> worksets(num_ws, workset);
+    for (int i = 0; i < num_ws; ++i)
+      loadWorksetBucketInfo<EvalT>(worksets[i], ws_of_color[i]);
+
+    int const num_threads = std::min(num_fill_threads_, num_ws);
+    std::atomic<int> next(0);
+    std::vector<std::exception_ptr> errors(num_threads);
+
+    // Worksets of one color share no DOFs, so the scatters into the
+    // overlapped residual and Jacobian do not race.
+    auto fill = [&](int const thread) {
+      auto &thread_fm = thread == 0 ? fm : fm_clones_[thread - 1];
+      try {
+        for (int i = next++; i < num_ws; i = next++) {
+          PHAL::WorksetProfile<EvalT> profile(worksets[i]);
+          thread_fm[wsPhysIndex[ws_of_color[i]]]
+              ->template evaluateFields<EvalT>(worksets[i]);
+        }
+      } catch (...) {
+        errors[thread] = std::current_exception();
+      }
+    };
+
+#if defined(KOKKOS_HAVE_OPENMP)
+    // Each partition master runs its workset kernels on the threads of its
+    // own partition. Kokkos may hand out fewer partitions than requested;
+    // the shared counter still covers all the worksets.
+    int const partition_size =
+        std::max(1, Kokkos::OpenMP::thread_pool_size() / num_threads);
+    Kokkos::OpenMP::partition_master(
+        [&](int const partition, int const) { fill(partition); }, num_threads,
+        partition_size);
+#else
+    fill(0);
+#endif
+
+    for (auto const &error : errors)
+      if (error)
+        std::rethrow_exception(error);
+  }
+}
+
+bool Albany::Application::linearJacobianReuseEnabled() const {
+  // Scaling, distributed parameters, Dirichlet perturbations and unversioned
+  // meshes can change the operators without changing the key, so they
+  // disable the reuse.
+  return reuse_linear_jacobian_ && !assembling_linear_operators_ &&
+         scale == 1.0 && perturbBetaForDirichlets == 0.0 &&
+         disc->getMeshVersion() >= 0 && distParamLib->size() == 0;
+}
+
+std::vector<double> Albany::Application::linearJacobianKey(
+    double const alpha, double const beta, double const omega,
+    double const current_time, Teuchos::Array<ParamVec> const &p) const {
+  std::vector<double> key{static_cast<double>(disc->getMeshVersion()), alpha,
+                          beta, omega, current_time};
+  for (int i = 0; i < p.size(); i++)
+    for (unsigned int j = 0; j < p[i].size(); j++)
+      key.push_back(p[i][j].baseValue);
+  return key;
+}
+
+std::vector<double> Albany::Application::linearOperatorKey(
+    double const current_time, Teuchos::Array<ParamVec> const &p) const {
+  std::vector<double> key{static_cast<double>(disc->getMeshVersion())};
+  // Unless declared otherwise, one assembly serves every time step
+  if (linear_time_dependent_)
+    key.push_back(current_time);
+  for (int i = 0; i < p.size(); i++)
+    for (unsigned int j = 0; j < p[i].size(); j++)
+      key.push_back(p[i][j].baseValue);
+  return key;
+}
+
+void Albany::Application::assembleLinearOperators(
+    std::vector<double> const &key, double const current_time,
+    Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xT,
+    Teuchos::Array<ParamVec> const &p,
+    Teuchos::RCP<Tpetra_CrsMatrix> const &jacT) {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Linear Operator Assembly");
+
+  // f = K x + M xdot + N xdotdot + c. Each operator is the Jacobian fill
+  // with the (alpha, beta, omega) that selects it; the residual of the
+  // first fill gives c.
+  double const coefficients[3][3] = {{0.0, 1.0, 0.0}, // K
+                                     {1.0, 0.0, 0.0}, // M
+                                     {0.0, 0.0, 1.0}}; // N
+  Teuchos::RCP<Tpetra_Vector const> const vectors[3] = {xT, xdotT, xdotdotT};
+  int const num_operators =
+      Teuchos::nonnull(xdotdotT) ? 3 : Teuchos::nonnull(xdotT) ? 2 : 1;
+
+  Teuchos::RCP<Tpetra_Vector> const offsetT =
+      Teuchos::rcp(new Tpetra_Vector(disc->getMapT()));
+  linear_operatorsT_.clear();
+  linear_offsetT_ = Teuchos::null;
+
+  assembling_linear_operators_ = true;
+  try {
+    for (int i = 0; i < num_operators; ++i) {
+      computeGlobalJacobianImplT(coefficients[i][0], coefficients[i][1],
+                                 coefficients[i][2], current_time, xdotT,
+                                 xdotdotT, xT, p,
+                                 i == 0 ? offsetT : Teuchos::null, jacT);
+      Teuchos::RCP<Tpetra_CrsMatrix> const op =
+          Teuchos::rcp(new Tpetra_CrsMatrix(jacT->getCrsGraph()));
+      copyMatrixValues(*jacT, *op);
+      op->fillComplete();
+      linear_operatorsT_.push_back(op);
+    }
+  } catch (...) {
+    assembling_linear_operators_ = false;
+    linear_operatorsT_.clear();
+    throw;
+  }
+  assembling_linear_operators_ = false;
+
+  for (int i = 0; i < num_operators; ++i)
+    linear_operatorsT_[i]->apply(*vectors[i], *offsetT, Teuchos::NO_TRANS,
+                                 -1.0, 1.0);
+  linear_offsetT_ = offsetT;
+  linear_offset_time_ = current_time;
+  linear_operator_key_ = key;
+}
+
+void Albany::Application::updateLinearOffset(
+    double const current_time, Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xT,
+    Teuchos::Array<ParamVec> const &p) {
+  Teuchos::RCP<Tpetra_Vector const> const vectors[3] = {xT, xdotT, xdotdotT};
+
+  assembling_linear_operators_ = true;
+  try {
+    computeGlobalResidualImplT(current_time, xdotT, xdotdotT, xT, p,
+                               linear_offsetT_);
+  } catch (...) {
+    assembling_linear_operators_ = false;
+    linear_operatorsT_.clear();
+    throw;
+  }
+  assembling_linear_operators_ = false;
+
+  for (std::size_t i = 0; i < linear_operatorsT_.size(); ++i)
+    if (Teuchos::nonnull(vectors[i]))
+      linear_operatorsT_[i]->apply(*vectors[i], *linear_offsetT_,
+                                   Teuchos::NO_TRANS, -1.0, 1.0);
+  linear_offset_time_ = current_time;
+}
+
+bool Albany::Application::applyLinearOperators(
+    std::vector<double> const &key, double const alpha, double const beta,
+    double const omega, double const current_time,
+    Teuchos::Array<ParamVec> const &p,
+    Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xT,
+    Teuchos::RCP<Tpetra_Vector> const &fT,
+    Teuchos::RCP<Tpetra_CrsMatrix> const &jacT) {
+  if (linear_operatorsT_.size() == 0 || key != linear_operator_key_)
+    return false;
+  std::size_t const needed =
+      Teuchos::nonnull(xdotdotT) || omega != 0.0
+          ? 3
+          : Teuchos::nonnull(xdotT) || alpha != 0.0 ? 2 : 1;
+  if (needed > linear_operatorsT_.size())
+    return false;
+
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Linear Jacobian Reuse");
+
+  if (Teuchos::nonnull(jacT)) {
+    // All operators share the graph of jacT, so J = beta K + alpha M +
+    // omega N is a combination of their local values.
+    double const weights[3] = {beta, alpha, omega};
+    if (jacT->isFillComplete())
+      jacT->resumeFill();
+    Teuchos::ArrayView<const LO> indices;
+    Teuchos::ArrayView<const ST> values;
+    Teuchos::Array<ST> combined;
+    LO const num_rows = jacT->getNodeNumRows();
+    for (LO row = 0; row < num_rows; ++row) {
+      linear_operatorsT_[0]->getLocalRowView(row, indices, values);
+      combined.assign(values.size(), 0.0);
+      for (std::size_t i = 0; i < linear_operatorsT_.size(); ++i) {
+        if (weights[i] == 0.0)
+          continue;
+        linear_operatorsT_[i]->getLocalRowView(row, indices, values);
+        for (int k = 0; k < values.size(); ++k)
+          combined[k] += weights[i] * values[k];
+      }
+      jacT->replaceLocalValues(row, indices, combined());
+    }
+    jacT->fillComplete();
+  }
+
+  if (Teuchos::nonnull(fT)) {
+    // Dirichlet values and sources that depend on time only change c, so
+    // one residual fill at each new time keeps K, M and N valid.
+    if (current_time != linear_offset_time_)
+      updateLinearOffset(current_time, xdotT, xdotdotT, xT, p);
+
+    Teuchos::RCP<Tpetra_Vector const> const vectors[3] = {xT, xdotT, xdotdotT};
+    fT->assign(*linear_offsetT_);
+    for (std::size_t i = 0; i < linear_operatorsT_.size(); ++i)
+      if (Teuchos::nonnull(vectors[i]))
+        linear_operatorsT_[i]->apply(*vectors[i], *fT, Teuchos::NO_TRANS, 1.0,
+                                     1.0);
+  }
+  return true;
+}
+
 void Albany::Application::computeGlobalResidualImplT(
     double const current_time, Teuchos::RCP<Tpetra_Vector const> const &xdotT,
     Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
@@ -1276,19 +1691,35 @@ void Albany::Application::computeGlobalResidualImplT(
 #if defined(ALBANY_LCM)
   // Store pointers to solution and time derivatives.
   // Needed for Schwarz coupling.
-  if (xT != Teuchos::null)
-    x_ = Teuchos::rcp(new Tpetra_Vector(*xT));
-  else
-    x_ = Teuchos::null;
-  if (xdotT != Teuchos::null)
-    xdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotT));
-  else
-    xdot_ = Teuchos::null;
-  if (xdotdotT != Teuchos::null)
-    xdotdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotdotT));
-  else
-    xdotdot_ = Teuchos::null;
+  if (is_x_frozen_ == false) {
+    if (xT != Teuchos::null)
+      x_ = Teuchos::rcp(new Tpetra_Vector(*xT));
+    else
+      x_ = Teuchos::null;
+    if (xdotT != Teuchos::null)
+      xdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotT));
+    else
+      xdot_ = Teuchos::null;
+    if (xdotdotT != Teuchos::null)
+      xdotdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotdotT));
+    else
+      xdotdot_ = Teuchos::null;
+  }
+#endif // ALBANY_LCM
+
+  // Linear problems: f = K x + M xdot + N xdotdot + c with the operators
+  // of the last assembly
+  if (linearJacobianReuseEnabled()) {
+    if (applyLinearOperators(linearOperatorKey(current_time, p), 0.0, 1.0,
+                             0.0, current_time, p, xdotT, xdotdotT, xT, fT,
+                             Teuchos::null)) {
+#if defined(ALBANY_LCM)
+      overlapped_fT->doImport(*fT, *importerT, Tpetra::INSERT);
+      disc->setResidualFieldT(*overlapped_fT);
 #endif // ALBANY_LCM
+      return;
+    }
+  }
 
   // Zero out overlapped residual - Tpetra
   overlapped_fT->putScalar(0.0);
@@ -1320,6 +1751,11 @@ void Albany::Application::computeGlobalResidualImplT(
 
     workset.fT = overlapped_fT;
 
+    // The Neumann field managers are not cloned, so with threads only the
+    // volumetric fill runs concurrently; nfm is evaluated below.
+    if (num_fill_threads_ > 1)
+      evaluateWorksetsThreaded<PHAL::AlbanyTraits::Residual>(workset);
+
     for (int ws = 0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
 
@@ -1333,8 +1769,13 @@ void Albany::Application::computeGlobalResidualImplT(
 #ifdef DEBUG_OUTPUT
       std::cout << "calling FM evaluate fields in computeGlobalResidualImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
-          workset);
+      if (Teuchos::nonnull(frozen_elements_))
+        frozen_elements_->clearFlags(ws, workset.numCells);
+      if (num_fill_threads_ == 1) {
+        PHAL::WorksetProfile<PHAL::AlbanyTraits::Residual> profile(workset);
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
+            workset);
+      }
       if (nfm != Teuchos::null) {
 #ifdef ALBANY_PERIDIGM
         // DJL this is a hack to avoid running a block with sphere elements
@@ -1597,6 +2038,22 @@ void Albany::Application::computeGlobalJacobianImplT(
 
   postRegSetup("Jacobian");
 
+  // Frozen worksets still need their residual
+  bool const freeze = Teuchos::nonnull(frozen_elements_) && !is_adjoint;
+  if (freeze && Teuchos::nonnull(fT))
+    postRegSetup("Residual");
+
+  if (linearJacobianReuseEnabled()) {
+    std::vector<double> const key = linearOperatorKey(current_time, p);
+    if (!applyLinearOperators(key, alpha, beta, omega, current_time, p, xdotT,
+                              xdotdotT, xT, fT, jacT)) {
+      assembleLinearOperators(key, current_time, xdotT, xdotdotT, xT, p, jacT);
+      applyLinearOperators(key, alpha, beta, omega, current_time, p, xdotT,
+                           xdotdotT, xT, fT, jacT);
+    }
+    return;
+  }
+
   // Load connectivity map and coordinates
   const auto &wsElNodeEqID = disc->getWsElNodeEqID();
   const auto &coords = disc->getCoords();
@@ -1679,14 +2136,48 @@ void Albany::Application::computeGlobalJacobianImplT(
                   this, ps, explicit_scheme));
     }
 
+    if (num_fill_threads_ > 1)
+      evaluateWorksetsThreaded<PHAL::AlbanyTraits::Jacobian>(workset);
+
+    // Element matrices depend on the mesh, the time, the coefficients and
+    // the parameters besides the solution and its time derivatives
+    if (freeze)
+      frozen_elements_->beginFill(
+          linearJacobianKey(alpha, beta, omega, this_time, p), numWorksets);
+
     for (int ws = 0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
       // FillType template argument used to specialize Sacado
 #ifdef DEBUG_OUTPUT
       std::cout << "calling FM evaluate fields in computeGlobalJacobianImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(
-          workset);
+      if (freeze && frozen_elements_->canReuse(ws, workset.wsElNodeEqID,
+                                               *workset.xT,
+                                               workset.xdotT.get(),
+                                               workset.xdotdotT.get())) {
+        frozen_elements_->replay(ws, workset.wsElNodeEqID, *overlapped_jacT);
+        if (Teuchos::nonnull(fT)) {
+          loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+          frozen_elements_->clearFlags(ws, workset.numCells);
+          fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
+              workset);
+          loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
+        }
+      } else if (freeze) {
+        frozen_elements_->beginRecording(ws, workset.wsElNodeEqID);
+        {
+          PHAL::WorksetProfile<PHAL::AlbanyTraits::Jacobian> profile(workset);
+          fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(
+              workset);
+        }
+        frozen_elements_->endRecording(ws, workset.wsElNodeEqID, *workset.xT,
+                                       workset.xdotT.get(),
+                                       workset.xdotdotT.get());
+      } else if (num_fill_threads_ == 1) {
+        PHAL::WorksetProfile<PHAL::AlbanyTraits::Jacobian> profile(workset);
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(
+            workset);
+      }
       if (Teuchos::nonnull(nfm))
 #ifdef ALBANY_PERIDIGM
         // DJL avoid passing a sphere mesh through a nfm that was
@@ -1700,6 +2191,13 @@ void Albany::Application::computeGlobalJacobianImplT(
             ->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
 #endif
     }
+
+    if (freeze) {
+      frozen_elements_->endFill();
+      *out << "Frozen elements: " << frozen_elements_->numReused()
+           << " reused, " << frozen_elements_->numRecomputed()
+           << " recomputed" << std::endl;
+    }
   }
 
   {
@@ -2389,6 +2887,14 @@ void Albany::Application::computeGlobalJacobianT(
 
 void Albany::Application::computeGlobalPreconditionerT(
     const RCP<Tpetra_CrsMatrix> &jac, const RCP<Tpetra_Operator> &prec) {
+  if (precType == "Block Jacobi") {
+    TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Precond");
+
+    RCP<Albany::BlockJacobiPreconditionerT> blockPrec =
+        rcp_dynamic_cast<Albany::BlockJacobiPreconditionerT>(prec, true);
+
+    blockPrec->compute(*jac);
+  }
 //#if defined(ATO_USES_COGENT)
 #ifdef ALBANY_ATO
   if (precType == "XFEM") {
@@ -2611,7 +3117,11 @@ void Albany::Application::computeGlobalTangentImplT(
 #ifdef DEBUG_OUTPUT
       std::cout << "calling FM evaluate fields in computeGlobalTangentImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
+      {
+        PHAL::WorksetProfile<PHAL::AlbanyTraits::Tangent> profile(workset);
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Tangent>(
+            workset);
+      }
       if (nfm != Teuchos::null)
         deref_nfm(nfm, wsPhysIndex, ws)
             ->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
@@ -2882,8 +3392,12 @@ void Albany::Application::applyGlobalDistParamDerivImplT(
 #ifdef DEBUG_OUTPUT
       std::cout << "calling FM evaluate fields in applyGlobalDistParamDerivImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::DistParamDeriv>(
-          workset);
+      {
+        PHAL::WorksetProfile<PHAL::AlbanyTraits::DistParamDeriv> profile(
+            workset);
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::DistParamDeriv>(
+            workset);
+      }
       if (nfm != Teuchos::null)
 #ifdef ALBANY_PERIDIGM
         // DJL avoid passing a sphere mesh through a nfm that was
@@ -3199,6 +3713,10 @@ void Albany::Application::postRegSetup(std::string eval) {
   if (eval == "Residual") {
     for (int ps = 0; ps < fm.size(); ps++)
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
+    for (int thread = 0; thread < fm_clones_.size(); thread++)
+      for (int ps = 0; ps < fm_clones_[thread].size(); ps++)
+        fm_clones_[thread][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (dfm != Teuchos::null)
       dfm->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (nfm != Teuchos::null)
@@ -3214,6 +3732,13 @@ void Albany::Application::postRegSetup(std::string eval) {
       fm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
           derivative_dimensions);
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      for (int thread = 0; thread < fm_clones_.size(); thread++) {
+        fm_clones_[thread][ps]
+            ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
+                derivative_dimensions);
+        fm_clones_[thread][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      }
       if (nfm != Teuchos::null && ps < nfm.size()) {
         nfm[ps]
             ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
@@ -3458,6 +3983,14 @@ void Albany::Application::loadBasicWorksetInfoT(PHAL::Workset &workset,
   // workset.delta_time = delta_time;
   workset.transientTerms = Teuchos::nonnull(workset.xdotT);
   workset.accelerationTerms = Teuchos::nonnull(workset.xdotdotT);
+  // Shape parameters and the reference configuration manager move the
+  // mesh without going through the discretization.
+  workset.cache_basis_functions = cache_basis_functions_ &&
+                                  shapeParams.size() == 0 &&
+                                  Teuchos::is_null(rc_mgr);
+  workset.cache_jacobian_offsets = cache_jacobian_offsets_;
+  workset.profile_evaluators = profile_evaluators_;
+  workset.frozen_elements = frozen_elements_;
 }
 
 void Albany::Application::loadBasicWorksetInfoSDBCsT(
@@ -4045,18 +4578,20 @@ void Albany::Application::computeGlobalResidualSDBCsImplT(
 #if defined(ALBANY_LCM)
   // Store pointers to solution and time derivatives.
   // Needed for Schwarz coupling.
-  if (xT != Teuchos::null)
-    x_ = Teuchos::rcp(new Tpetra_Vector(*xT));
-  else
-    x_ = Teuchos::null;
-  if (xdotT != Teuchos::null)
-    xdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotT));
-  else
-    xdot_ = Teuchos::null;
-  if (xdotdotT != Teuchos::null)
-    xdotdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotdotT));
-  else
-    xdotdot_ = Teuchos::null;
+  if (is_x_frozen_ == false) {
+    if (xT != Teuchos::null)
+      x_ = Teuchos::rcp(new Tpetra_Vector(*xT));
+    else
+      x_ = Teuchos::null;
+    if (xdotT != Teuchos::null)
+      xdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotT));
+    else
+      xdot_ = Teuchos::null;
+    if (xdotdotT != Teuchos::null)
+      xdotdot_ = Teuchos::rcp(new Tpetra_Vector(*xdotdotT));
+    else
+      xdotdot_ = Teuchos::null;
+  }
 #endif // ALBANY_LCM
 
   // Zero out overlapped residual - Tpetra
@@ -42,6 +42,7 @@
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Workset.hpp"
 #include <set>
+#include <vector>
 
 #if defined(ALBANY_EPETRA)
 
@@ -451,6 +452,62 @@ private:
   void
   removeEpetraRelatedPLs(const Teuchos::RCP<Teuchos::ParameterList> &params);
 
+  //! Build per-thread field manager clones for the threaded fill; called
+  //! from buildProblem, while states can still be registered
+  void setupThreadedFill();
+
+  //! Group worksets into colors such that no two worksets of the same
+  //! color touch the same overlapped node
+  void computeWorksetColoring();
+
+  //! Evaluate the volumetric field managers on all worksets, one color
+  //! at a time, using num_fill_threads_ threads
+  template <typename EvalT>
+  void evaluateWorksetsThreaded(PHAL::Workset const &workset);
+
+  //! True if "Linear Jacobian Reuse" is requested and can be honored
+  bool linearJacobianReuseEnabled() const;
+
+  //! Everything the Jacobian fill depends on besides the solution: mesh
+  //! version, coefficients, time and parameter values
+  std::vector<double> linearJacobianKey(double alpha, double beta,
+                                        double omega, double current_time,
+                                        Teuchos::Array<ParamVec> const &p) const;
+
+  //! Everything the operators of a linear problem depend on: mesh version,
+  //! parameter values and, if "Linear Problem Time Dependent", time
+  std::vector<double> linearOperatorKey(double current_time,
+                                        Teuchos::Array<ParamVec> const &p) const;
+
+  //! Assemble K = df/dx, M = df/dxdot and N = df/dxdotdot, as far as the
+  //! problem has time derivatives, and c = f - K x - M xdot - N xdotdot
+  void assembleLinearOperators(std::vector<double> const &key,
+                               double current_time,
+                               Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+                               Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+                               Teuchos::RCP<Tpetra_Vector const> const &xT,
+                               Teuchos::Array<ParamVec> const &p,
+                               Teuchos::RCP<Tpetra_CrsMatrix> const &jacT);
+
+  //! Recompute c = f - K x - M xdot - N xdotdot with a residual fill
+  void updateLinearOffset(double current_time,
+                          Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+                          Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+                          Teuchos::RCP<Tpetra_Vector const> const &xT,
+                          Teuchos::Array<ParamVec> const &p);
+
+  //! Fill jacT = alpha M + beta K + omega N and/or fT from the stored
+  //! operators, updating c first if current_time is new. Returns false if
+  //! they do not match key or lack an operator.
+  bool applyLinearOperators(std::vector<double> const &key, double alpha,
+                            double beta, double omega, double current_time,
+                            Teuchos::Array<ParamVec> const &p,
+                            Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+                            Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+                            Teuchos::RCP<Tpetra_Vector const> const &xT,
+                            Teuchos::RCP<Tpetra_Vector> const &fT,
+                            Teuchos::RCP<Tpetra_CrsMatrix> const &jacT);
+
 public:
   //! Routine to get workset (bucket) size info needed by all Evaluation types
   template <typename EvalT>
@@ -638,6 +695,25 @@ public:
   bool
   getSchwarzAlternating() const {return is_schwarz_alternating_;}
 
+  // Fix the solution returned by getX(), getXdot() and getXdotdot() to
+  // the given vectors until thawX() is called. Evaluations in between do
+  // not update them. Used by additive Schwarz, where every subdomain sees
+  // the solutions of the previous iteration.
+  void
+  freezeX(
+      Teuchos::RCP<Tpetra_Vector const> const & x,
+      Teuchos::RCP<Tpetra_Vector const> const & xdot,
+      Teuchos::RCP<Tpetra_Vector const> const & xdotdot)
+  {
+    x_ = x;
+    xdot_ = xdot;
+    xdotdot_ = xdotdot;
+    is_x_frozen_ = true;
+  }
+
+  void
+  thawX() {is_x_frozen_ = false;}
+
 private:
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> apps_;
 
@@ -656,6 +732,8 @@ private:
 
   bool is_schwarz_alternating_{false};
 
+  bool is_x_frozen_{false};
+
 #endif // ALBANY_LCM
 
   std::vector<double> prev_times_;
@@ -732,6 +810,20 @@ protected:
   //! Phalanx Field Manager for states
   Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>> sfm;
 
+  //! Number of threads used for the volumetric fill ("Fill Threads")
+  int num_fill_threads_{1};
+
+  //! Clones of fm, one per additional fill thread
+  Teuchos::Array<
+      Teuchos::ArrayRCP<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>>>
+      fm_clones_;
+
+  //! Workset indices grouped by color for the threaded fill
+  Teuchos::Array<Teuchos::Array<int>> ws_colors_;
+
+  //! Number of cells covered by ws_colors_, used to detect remeshing
+  std::size_t ws_colors_num_cells_{0};
+
 #if defined(ALBANY_EPETRA)
   //! Product multi-comm
   Teuchos::RCP<const EpetraExt::MultiComm> product_comm;
@@ -794,6 +886,35 @@ protected:
   bool morphFromInit;
   bool ignore_residual_in_jacobian;
 
+  //! Reuse basis function data across fills on a static mesh
+  bool cache_basis_functions_{false};
+
+  //! Scatter the Jacobian through precomputed value offsets
+  bool cache_jacobian_offsets_{false};
+
+  //! Record per-evaluator statistics in util::PerformanceContext
+  bool profile_evaluators_{false};
+
+  //! Element Jacobians reused across fills, null unless "Frozen Element
+  //! Jacobians" is set
+  Teuchos::RCP<Albany::FrozenElements> frozen_elements_;
+
+  //! Assemble the operators of a linear problem once and evaluate the
+  //! Jacobian and the residual from them afterwards
+  bool reuse_linear_jacobian_{false};
+
+  //! The operators or loads of the linear problem change with time
+  bool linear_time_dependent_{false};
+
+  //! Set while assembleLinearOperators runs the fills
+  bool assembling_linear_operators_{false};
+
+  //! Stored K, M and N, their key, the residual offset c and its time
+  std::vector<double> linear_operator_key_;
+  std::vector<Teuchos::RCP<Tpetra_CrsMatrix>> linear_operatorsT_;
+  Teuchos::RCP<Tpetra_Vector> linear_offsetT_;
+  double linear_offset_time_{0.0};
+
   //! To prevent a singular mass matrix associated with Dirichlet
   //  conditions, optionally add a small perturbation to the diag
   double perturbBetaForDirichlets;
@@ -0,0 +1,113 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_BlockJacobiPreconditionerT.hpp"
+
+#include "Teuchos_LAPACK.hpp"
+#include "Teuchos_TestForException.hpp"
+
+Albany::BlockJacobiPreconditionerT::BlockJacobiPreconditionerT(
+    const Teuchos::RCP<const AbstractDiscretization>& disc_) :
+  disc(disc_),
+  map(disc_->getMapT()),
+  neq(disc_->getNumEq()),
+  num_nodes(0)
+{
+}
+
+void
+Albany::BlockJacobiPreconditionerT::compute(const Tpetra_CrsMatrix& jac)
+{
+  // The mesh may have changed since the last call
+  map = disc->getMapT();
+  neq = disc->getNumEq();
+  num_nodes = disc->getNodeMapT()->getNodeNumElements();
+
+  const NodalDOFManager& dofManager = disc->getDOFManager("ordinary_solution");
+  dofs.resize(num_nodes * neq);
+  for (LO inode = 0; inode < num_nodes; ++inode)
+    for (int i = 0; i < neq; ++i)
+      dofs[inode * neq + i] = dofManager.getLocalDOF(inode, i);
+
+  const Teuchos::RCP<const Tpetra_Map> rowMap = jac.getRowMap();
+  const Teuchos::RCP<const Tpetra_Map> colMap = jac.getColMap();
+
+  const int bsize = neq * neq;
+  inv_blocks.assign(num_nodes * bsize, 0.0);
+
+  Teuchos::LAPACK<int, ST> lapack;
+  std::vector<int> ipiv(neq);
+  std::vector<ST> work(bsize);
+  std::vector<Tpetra_GO> block_gids(neq);
+
+  Teuchos::ArrayView<const LO> indices;
+  Teuchos::ArrayView<const ST> values;
+
+  for (LO inode = 0; inode < num_nodes; ++inode) {
+    ST* const block = &inv_blocks[inode * bsize];
+    const LO* const node_dofs = &dofs[inode * neq];
+
+    for (int j = 0; j < neq; ++j)
+      block_gids[j] = map->getGlobalElement(node_dofs[j]);
+
+    for (int i = 0; i < neq; ++i) {
+      const LO row = rowMap->getLocalElement(block_gids[i]);
+      jac.getLocalRowView(row, indices, values);
+      for (int k = 0; k < indices.size(); ++k) {
+        const Tpetra_GO gid = colMap->getGlobalElement(indices[k]);
+        for (int j = 0; j < neq; ++j) {
+          if (gid == block_gids[j]) {
+            block[i + j * neq] = values[k];
+            break;
+          }
+        }
+      }
+    }
+
+    int info = 0;
+    lapack.GETRF(neq, neq, block, neq, &ipiv[0], &info);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        info != 0, std::runtime_error,
+        "BlockJacobiPreconditionerT: singular block at node "
+            << disc->getNodeMapT()->getGlobalElement(inode) << std::endl);
+    lapack.GETRI(neq, block, neq, &ipiv[0], &work[0], bsize, &info);
+  }
+}
+
+void
+Albany::BlockJacobiPreconditionerT::apply(
+    const Tpetra_MultiVector& X,
+    Tpetra_MultiVector& Y,
+    Teuchos::ETransp mode,
+    ST a,
+    ST b) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      mode != Teuchos::NO_TRANS, std::logic_error,
+      "BlockJacobiPreconditionerT: transpose apply is not supported\n");
+
+  const int bsize = neq * neq;
+  std::vector<ST> y_block(neq);
+
+  for (std::size_t col = 0; col < X.getNumVectors(); ++col) {
+    const Teuchos::ArrayRCP<const ST> x = X.getData(col);
+    const Teuchos::ArrayRCP<ST> y = Y.getDataNonConst(col);
+    for (LO inode = 0; inode < num_nodes; ++inode) {
+      const ST* const block = &inv_blocks[inode * bsize];
+      const LO* const node_dofs = &dofs[inode * neq];
+      for (int i = 0; i < neq; ++i) {
+        ST sum = 0.0;
+        for (int j = 0; j < neq; ++j)
+          sum += block[i + j * neq] * x[node_dofs[j]];
+        y_block[i] = sum;
+      }
+      for (int i = 0; i < neq; ++i) {
+        ST& yi = y[node_dofs[i]];
+        yi = (b == 0.0) ? a * y_block[i] : a * y_block[i] + b * yi;
+      }
+    }
+  }
+}
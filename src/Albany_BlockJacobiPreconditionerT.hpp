@@ -0,0 +1,87 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_BLOCK_JACOBI_PRECONDITIONER_T_HPP
+#define ALBANY_BLOCK_JACOBI_PRECONDITIONER_T_HPP
+
+#include "Albany_DataTypes.hpp"
+#include "Albany_AbstractDiscretization.hpp"
+
+#include "Teuchos_RCP.hpp"
+
+#include <vector>
+
+namespace Albany {
+
+  //! Nodal block-diagonal (block Jacobi) preconditioner
+  /*!
+   * The neq x neq block coupling the equations at each owned node is
+   * extracted from an assembled Jacobian and inverted in compute(). apply()
+   * multiplies by the block inverses, so it is cheap and needs no
+   * communication. It is meant as a lightweight preconditioner for the
+   * matrix-free Jacobian, where it may be rebuilt only every few Newton
+   * steps.
+   */
+  class BlockJacobiPreconditionerT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    BlockJacobiPreconditionerT(
+        const Teuchos::RCP<const AbstractDiscretization>& disc);
+
+    //! Destructor
+    virtual ~BlockJacobiPreconditionerT() {}
+
+    //! Extract and invert the nodal blocks of the Jacobian jac
+    void compute(const Tpetra_CrsMatrix& jac);
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    virtual void apply(const Tpetra_MultiVector& X,
+                      Tpetra_MultiVector& Y,  Teuchos::ETransp  mode = Teuchos::NO_TRANS,
+                      ST a = Teuchos::ScalarTraits<ST>::one(),
+                      ST b = Teuchos::ScalarTraits<ST>::zero() ) const;
+
+    virtual bool hasTransposeApply() const {
+      return false;
+    }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return map;
+    }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return map;
+    }
+
+    //@}
+
+  protected:
+
+    //! Discretization, for the map and the nodal DOF layout
+    Teuchos::RCP<const AbstractDiscretization> disc;
+
+    //! Owned solution map
+    Teuchos::RCP<const Tpetra_Map> map;
+
+    //! Number of equations per node
+    int neq;
+
+    //! Number of owned nodes
+    LO num_nodes;
+
+    //! Local DOF indices, neq per node
+    std::vector<LO> dofs;
+
+    //! Inverse of the nodal blocks, neq*neq per node in column major order
+    std::vector<ST> inv_blocks;
+
+  }; // class BlockJacobiPreconditionerT
+
+} // namespace Albany
+
+#endif // ALBANY_BLOCK_JACOBI_PRECONDITIONER_T_HPP
@@ -0,0 +1,102 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_ConcurrentSolves.hpp"
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_TimeMonitor.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// The registry of all Teuchos timers is a protected member of
+// Teuchos::TimeMonitor.
+class TimerRegistry : public Teuchos::TimeMonitor
+{
+ public:
+  static std::vector<Teuchos::RCP<Teuchos::Time>>
+  enabledTimers()
+  {
+    std::vector<Teuchos::RCP<Teuchos::Time>> timers;
+    for (auto const& it : counters()) {
+      if (it.second->isEnabled()) timers.push_back(it.second);
+    }
+    return timers;
+  }
+};
+
+}  // namespace
+
+std::string
+Albany::concurrentSolvesUnavailable()
+{
+#if !defined(HAVE_TEUCHOS_THREAD_SAFE)
+  return "it requires Trilinos configured with Teuchos_ENABLE_THREAD_SAFE=ON";
+#else
+  int thread_level = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&thread_level);
+  if (thread_level < MPI_THREAD_MULTIPLE)
+    return "it requires MPI initialized with MPI_THREAD_MULTIPLE";
+
+#if defined(KOKKOS_HAVE_OPENMP)
+  bool const openmp_device =
+      std::is_same<PHX::Device::execution_space, Kokkos::OpenMP>::value;
+#else
+  bool const openmp_device = false;
+#endif
+  if (!openmp_device)
+    return "it requires the Kokkos OpenMP execution space for Phalanx";
+
+  return "";
+#endif
+}
+
+void
+Albany::runConcurrentSolves(
+    int const num_tasks, std::function<void(int)> const& task)
+{
+  std::vector<std::exception_ptr> errors(num_tasks);
+  std::atomic<int>                next(0);
+
+  auto run = [&]() {
+    for (int i = next++; i < num_tasks; i = next++) {
+      try {
+        task(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  // A disabled timer neither starts, stops nor counts calls, so the tasks
+  // only read it. Timers running around this call resume afterwards.
+  std::vector<Teuchos::RCP<Teuchos::Time>> const paused =
+      TimerRegistry::enabledTimers();
+  for (auto const& timer : paused) timer->disable();
+
+#if defined(KOKKOS_HAVE_OPENMP)
+  int const num_partitions =
+      std::max(1, std::min(num_tasks, Kokkos::OpenMP::thread_pool_size()));
+  int const partition_size =
+      std::max(1, Kokkos::OpenMP::thread_pool_size() / num_partitions);
+  Kokkos::OpenMP::partition_master(
+      [&](int const, int const) { run(); }, num_partitions, partition_size);
+#else
+  run();
+#endif
+
+  for (auto const& timer : paused) timer->enable();
+
+  for (auto const& error : errors)
+    if (error) std::rethrow_exception(error);
+}
@@ -0,0 +1,46 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_CONCURRENTSOLVES_HPP
+#define ALBANY_CONCURRENTSOLVES_HPP
+
+#include <functional>
+#include <string>
+
+namespace Albany {
+
+/*!
+ * \brief Why independent solves cannot run concurrently in this build and
+ * MPI environment; empty if they can.
+ *
+ * Concurrent solves need atomic RCP reference counts
+ * (Teuchos_ENABLE_THREAD_SAFE=ON), MPI initialized with
+ * MPI_THREAD_MULTIPLE, since every solve communicates on its own thread,
+ * and the Kokkos OpenMP execution space for Phalanx, so that every solve
+ * can launch its kernels on its own partition of the thread pool.
+ */
+std::string
+concurrentSolvesUnavailable();
+
+/*!
+ * \brief Run task(0), ..., task(num_tasks - 1) concurrently, each solve
+ * on the master thread of its own Kokkos::OpenMP partition.
+ *
+ * The Teuchos timers are global and not thread safe, so they are disabled
+ * while the tasks run; time spent in the tasks is not recorded in them.
+ * Timers are created on first use, so the tasks must have been run
+ * serially once before. The first exception thrown by a task is rethrown
+ * after all tasks have finished.
+ *
+ * Only call this if concurrentSolvesUnavailable() returned an empty
+ * string.
+ */
+void
+runConcurrentSolves(int num_tasks, std::function<void(int)> const& task);
+
+}  // namespace Albany
+
+#endif  // ALBANY_CONCURRENTSOLVES_HPP
@@ -19,6 +19,7 @@
 #include "Sacado_ELRCacheFad_DFad.hpp"
 #include "Sacado_Fad_DFad.hpp"
 #include "Sacado_Fad_SLFad.hpp"
+#include "Sacado_Fad_SFad.hpp"
 #include "Sacado_ELRFad_SLFad.hpp"
 #include "Sacado_ELRFad_SFad.hpp"
 #include "Sacado_CacheFad_DFad.hpp"
@@ -32,7 +33,12 @@
 typedef double RealType;
 
 // Switch between dynamic and static FAD types
-#ifdef ALBANY_FAST_FELIX
+#if defined(ALBANY_SFAD)
+  // Exact-size static FAD: every element block must have
+  // neq*numNodes == ALBANY_SFAD_SIZE
+#define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
+  typedef Sacado::Fad::SFad<RealType, ALBANY_SFAD_SIZE> FadType;
+#elif defined(ALBANY_FAST_FELIX)
   // Code templated on data type need to know if FadType and TanFadType
   // are the same or different typdefs
 #define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
@@ -0,0 +1,198 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_FrozenElements.hpp"
+
+#include "utility/CounterMonitor.hpp"
+#include "utility/PerformanceContext.hpp"
+
+#include <cmath>
+
+namespace {
+
+// Values of v at the dofs of the cells of a workset, appended to values
+void
+gatherCellValues(
+    Albany::AbstractDiscretization::WorksetConn const& nodeID,
+    Tpetra_Vector const&                               v,
+    std::vector<ST>&                                   values)
+{
+  Teuchos::ArrayRCP<ST const> const v_view = v.get1dView();
+  for (int cell = 0; cell < nodeID.dimension(0); ++cell)
+    for (int node = 0; node < nodeID.dimension(1); ++node)
+      for (int eq = 0; eq < nodeID.dimension(2); ++eq)
+        values.push_back(v_view[nodeID(cell, node, eq)]);
+}
+
+// True if no value of v at the dofs of the cells moved by more than
+// tolerance from old_values, which advances past them
+bool
+cellValuesUnchanged(
+    Albany::AbstractDiscretization::WorksetConn const& nodeID,
+    Tpetra_Vector const&                               v,
+    ST const*&                                         old_values,
+    double const                                       tolerance)
+{
+  Teuchos::ArrayRCP<ST const> const v_view = v.get1dView();
+  for (int cell = 0; cell < nodeID.dimension(0); ++cell)
+    for (int node = 0; node < nodeID.dimension(1); ++node)
+      for (int eq = 0; eq < nodeID.dimension(2); ++eq, ++old_values)
+        if (std::abs(v_view[nodeID(cell, node, eq)] - *old_values) > tolerance)
+          return false;
+  return true;
+}
+
+}  // namespace
+
+Albany::FrozenElements::FrozenElements(
+    double const tolerance,
+    bool const   requires_flag)
+    : tolerance_(tolerance), requires_flag_(requires_flag)
+{
+}
+
+void
+Albany::FrozenElements::beginFill(
+    std::vector<double> const& key,
+    int const                  num_worksets)
+{
+  if (key != key_ || static_cast<int>(worksets_.size()) != num_worksets) {
+    key_ = key;
+    worksets_.clear();
+    worksets_.resize(num_worksets);
+  }
+  recording_ws_   = -1;
+  num_reused_     = 0;
+  num_recomputed_ = 0;
+}
+
+void
+Albany::FrozenElements::endFill()
+{
+  util::CounterMonitor& cmonitor =
+      util::PerformanceContext::instance().counterMonitor();
+
+  *cmonitor["Frozen Elements: Reused"] += num_reused_;
+  *cmonitor["Frozen Elements: Recomputed"] += num_recomputed_;
+}
+
+void
+Albany::FrozenElements::clearFlags(int const ws, int const num_cells)
+{
+  if (ws >= static_cast<int>(worksets_.size())) worksets_.resize(ws + 1);
+  worksets_[ws].unchanged.assign(num_cells, 0);
+}
+
+bool
+Albany::FrozenElements::canReuse(
+    int const                                  ws,
+    AbstractDiscretization::WorksetConn const& nodeID,
+    Tpetra_Vector const&                       x,
+    Tpetra_Vector const*                       xdot,
+    Tpetra_Vector const*                       xdotdot) const
+{
+  if (ws >= static_cast<int>(worksets_.size())) return false;
+
+  WorksetData const& data      = worksets_[ws];
+  int const          num_cells = nodeID.dimension(0);
+  int const          num_dofs  = nodeID.dimension(1) * nodeID.dimension(2);
+  int const          num_vectors =
+      1 + (xdot != nullptr ? 1 : 0) + (xdotdot != nullptr ? 1 : 0);
+
+  if (data.valid == false || data.nunk != num_dofs ||
+      data.have_xdot != (xdot != nullptr) ||
+      data.have_xdotdot != (xdotdot != nullptr) ||
+      static_cast<int>(data.solution.size()) !=
+          num_vectors * num_cells * num_dofs) {
+    return false;
+  }
+
+  if (requires_flag_ == true) {
+    if (static_cast<int>(data.unchanged.size()) != num_cells) return false;
+    for (int cell = 0; cell < num_cells; ++cell)
+      if (data.unchanged[cell] == 0) return false;
+  }
+
+  ST const* old_values = data.solution.data();
+  if (!cellValuesUnchanged(nodeID, x, old_values, tolerance_)) return false;
+  if (xdot != nullptr &&
+      !cellValuesUnchanged(nodeID, *xdot, old_values, tolerance_))
+    return false;
+  if (xdotdot != nullptr &&
+      !cellValuesUnchanged(nodeID, *xdotdot, old_values, tolerance_))
+    return false;
+
+  return true;
+}
+
+void
+Albany::FrozenElements::replay(
+    int const                                  ws,
+    AbstractDiscretization::WorksetConn const& nodeID,
+    Tpetra_CrsMatrix&                          jac)
+{
+  WorksetData const& data      = worksets_[ws];
+  int const          num_cells = nodeID.dimension(0);
+  int const          num_nodes = nodeID.dimension(1);
+  int const          neq       = nodeID.dimension(2);
+  int const          nunk      = data.nunk;
+
+  Teuchos::Array<LO> cols(nunk);
+  ST const*          row_values = data.jacobians.data();
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int node = 0; node < num_nodes; ++node)
+      for (int eq = 0; eq < neq; ++eq)
+        cols[node * neq + eq] = nodeID(cell, node, eq);
+    for (int row = 0; row < nunk; ++row, row_values += nunk) {
+      jac.sumIntoLocalValues(
+          cols[row], cols, Teuchos::arrayView(row_values, nunk));
+    }
+  }
+  num_reused_ += num_cells;
+}
+
+void
+Albany::FrozenElements::beginRecording(
+    int const                                  ws,
+    AbstractDiscretization::WorksetConn const& nodeID)
+{
+  int const num_cells = nodeID.dimension(0);
+  int const nunk      = nodeID.dimension(1) * nodeID.dimension(2);
+
+  clearFlags(ws, num_cells);
+
+  WorksetData& data = worksets_[ws];
+  data.nunk         = nunk;
+  data.recorded     = false;
+  data.valid        = false;
+  data.jacobians.assign(num_cells * nunk * nunk, 0.0);
+  recording_ws_ = ws;
+}
+
+void
+Albany::FrozenElements::endRecording(
+    int const                                  ws,
+    AbstractDiscretization::WorksetConn const& nodeID,
+    Tpetra_Vector const&                       x,
+    Tpetra_Vector const*                       xdot,
+    Tpetra_Vector const*                       xdotdot)
+{
+  WorksetData& data      = worksets_[ws];
+  int const    num_cells = nodeID.dimension(0);
+
+  data.solution.clear();
+  gatherCellValues(nodeID, x, data.solution);
+  if (xdot != nullptr) gatherCellValues(nodeID, *xdot, data.solution);
+  if (xdotdot != nullptr) gatherCellValues(nodeID, *xdotdot, data.solution);
+  data.have_xdot    = xdot != nullptr;
+  data.have_xdotdot = xdotdot != nullptr;
+
+  // A workset whose residual is not scattered by PHAL::ScatterResidual
+  // recorded nothing and can never be reused
+  data.valid    = data.recorded;
+  recording_ws_ = -1;
+  num_recomputed_ += num_cells;
+}
@@ -0,0 +1,171 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_FROZENELEMENTS_HPP
+#define ALBANY_FROZENELEMENTS_HPP
+
+#include "Albany_AbstractDiscretization.hpp"
+#include "Albany_DataTypes.hpp"
+
+#include <vector>
+
+namespace Albany {
+
+/*! Element Jacobian cache for Jacobian fills in which most of the domain
+ *  behaves (nearly) linearly, e.g. elastic regions around a localized
+ *  plastic zone.
+ *
+ *  While a workset is evaluated under PHAL::AlbanyTraits::Jacobian, the
+ *  Jacobian scatter records the element matrices of its cells. In a later
+ *  fill, Albany::Application adds the recorded matrices to the Jacobian
+ *  instead of evaluating the workset again if, for every cell of the
+ *  workset,
+ *  - an evaluator flagged the cell with flagUnchanged() in the last
+ *    evaluation of the workset (unless "Frozen Element Requires Flag" is
+ *    false), and
+ *  - no solution value of the cell, and no value of its first and second
+ *    time derivatives, moved by more than "Frozen Element Tolerance"
+ *    since the matrices were recorded.
+ *  The element matrices are also dropped when the mesh, the time, the time
+ *  integration coefficients or the parameters change.
+ *
+ *  The residual is always evaluated exactly, so a reused element matrix
+ *  only affects the convergence rate of Newton's method.
+ *
+ *  Reused and recomputed cells are counted per fill, and added to
+ *  util::PerformanceContext::instance().counterMonitor() under
+ *  "Frozen Elements: Reused" and "Frozen Elements: Recomputed".
+ */
+class FrozenElements {
+ public:
+  FrozenElements(double tolerance, bool requires_flag);
+
+  //! Start a Jacobian fill. key holds everything the element matrices
+  //! depend on besides the solution.
+  void
+  beginFill(std::vector<double> const& key, int num_worksets);
+
+  //! End a Jacobian fill and update the counters
+  void
+  endFill();
+
+  //! Forget the flags of the workset before it is evaluated again
+  void
+  clearFlags(int ws, int num_cells);
+
+  //! Called by evaluators: the state of the cell did not change since the
+  //! last Jacobian fill
+  void
+  flagUnchanged(int ws, int cell)
+  {
+    if (ws < static_cast<int>(worksets_.size()) &&
+        cell < static_cast<int>(worksets_[ws].unchanged.size())) {
+      worksets_[ws].unchanged[cell] = 1;
+    }
+  }
+
+  //! True if the recorded element matrices of the workset can be used at
+  //! the overlapped solution x and time derivatives xdot and xdotdot, which
+  //! are null if the problem does not have them
+  bool
+  canReuse(
+      int ws,
+      AbstractDiscretization::WorksetConn const& nodeID,
+      Tpetra_Vector const& x,
+      Tpetra_Vector const* xdot,
+      Tpetra_Vector const* xdotdot) const;
+
+  //! Add the recorded element matrices of the workset to jac
+  void
+  replay(
+      int ws,
+      AbstractDiscretization::WorksetConn const& nodeID,
+      Tpetra_CrsMatrix& jac);
+
+  //! Start recording the element matrices of the workset
+  void
+  beginRecording(int ws, AbstractDiscretization::WorksetConn const& nodeID);
+
+  //! Stop recording and remember the overlapped solution x and time
+  //! derivatives xdot and xdotdot (null if absent)
+  void
+  endRecording(
+      int ws,
+      AbstractDiscretization::WorksetConn const& nodeID,
+      Tpetra_Vector const& x,
+      Tpetra_Vector const* xdot,
+      Tpetra_Vector const* xdotdot);
+
+  //! Called by the Jacobian scatter: the row of the element matrix of the
+  //! cell to sum the derivatives into, or nullptr if the workset is not
+  //! being recorded. row is node * neq + eq.
+  ST*
+  recordingRow(int ws, int cell, int row)
+  {
+    if (ws != recording_ws_) return nullptr;
+    WorksetData& data = worksets_[ws];
+    data.recorded = true;
+    return &data.jacobians[(cell * data.nunk + row) * data.nunk];
+  }
+
+  //! Cells whose element matrices were reused in the last fill
+  std::size_t
+  numReused() const
+  {
+    return num_reused_;
+  }
+
+  //! Cells evaluated under Jacobian in the last fill
+  std::size_t
+  numRecomputed() const
+  {
+    return num_recomputed_;
+  }
+
+ private:
+  struct WorksetData
+  {
+    //! Cells flagged by an evaluator
+    std::vector<char> unchanged;
+
+    //! Element matrices, row major, nunk x nunk per cell
+    std::vector<ST> jacobians;
+
+    //! Solution values of the cells when the matrices were recorded,
+    //! followed by those of xdot and xdotdot if present
+    std::vector<ST> solution;
+
+    //! Whether xdot and xdotdot were present when recording
+    bool have_xdot{false};
+
+    bool have_xdotdot{false};
+
+    int nunk{0};
+
+    //! Whether the scatter wrote anything while recording
+    bool recorded{false};
+
+    bool valid{false};
+  };
+
+  double tolerance_;
+
+  bool requires_flag_;
+
+  std::vector<double> key_;
+
+  std::vector<WorksetData> worksets_;
+
+  int recording_ws_{-1};
+
+  std::size_t num_reused_{0};
+
+  std::size_t num_recomputed_{0};
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_FROZENELEMENTS_HPP
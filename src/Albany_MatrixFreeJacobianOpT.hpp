@@ -0,0 +1,154 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+#define ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+
+#include "Albany_DataTypes.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include "Albany_Application.hpp"
+
+namespace Albany {
+
+  //! Tpetra_Operator implementing the action of the Jacobian
+  /*!
+   * This class implements the Tpetra_Operator interface for
+   * W*v = (alpha*df/dxdot + beta*df/dx + omega*df/dxdotdot)*v, where f is
+   * the Albany residual vector. Every apply() is a Tangent fill seeded
+   * with v, so the Jacobian is never assembled.
+   */
+  class MatrixFreeJacobianOpT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    MatrixFreeJacobianOpT(const Teuchos::RCP<Application>& app_) :
+      app(app_) {}
+
+    //! Destructor
+    virtual ~MatrixFreeJacobianOpT() {}
+
+    //! Set the point at which the Jacobian is applied. The vectors are
+    //! copied, as the solver may change them before apply() is called.
+    void set(const double alpha_, const double beta_, const double omega_,
+             const double time_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdotdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& x_,
+             const Teuchos::Array<ParamVec>& scalar_params_) {
+      alpha = alpha_;
+      beta = beta_;
+      omega = omega_;
+      time = time_;
+      copy(xdot_, xdot);
+      copy(xdotdot_, xdotdot);
+      copy(x_, x);
+      scalar_params = scalar_params_;
+    }
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    /*!
+     * \brief Returns the result of a Tpetra_Operator applied to a
+     * Tpetra_MultiVector X in Y.
+     */
+    virtual void apply(const Tpetra_MultiVector& X,
+                      Tpetra_MultiVector& Y,  Teuchos::ETransp  mode = Teuchos::NO_TRANS,
+                      ST a = Teuchos::ScalarTraits<ST>::one(),
+                      ST b = Teuchos::ScalarTraits<ST>::zero() ) const {
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          mode != Teuchos::NO_TRANS, std::logic_error,
+          "MatrixFreeJacobianOpT: transpose apply is not supported\n");
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          x.is_null(), std::logic_error,
+          "MatrixFreeJacobianOpT: apply() called before set()\n");
+
+      Tpetra_MultiVector JX(Y.getMap(), X.getNumVectors());
+      app->computeGlobalTangentT(alpha, beta, omega, time, false,
+                                 xdot.get(), xdotdot.get(), *x,
+                                 scalar_params, NULL,
+                                 &X,
+                                 xdot.is_null() ? NULL : &X,
+                                 xdotdot.is_null() ? NULL : &X,
+                                 NULL, NULL, &JX, NULL);
+      Y.update(a, JX, b);
+    }
+
+    //! Returns a character string describing the operator
+    virtual const char * Label() const {
+      return "MatrixFreeJacobianOpT";
+    }
+
+    virtual bool hasTransposeApply() const {
+      return false;
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the domain of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return app->getMapT();
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the range of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return app->getMapT();
+    }
+
+    //@}
+
+  protected:
+
+    static void copy(const Teuchos::RCP<const Tpetra_Vector>& src,
+                     Teuchos::RCP<Tpetra_Vector>& dst) {
+      if (src.is_null()) {
+        dst = Teuchos::null;
+        return;
+      }
+      if (dst.is_null() || !dst->getMap()->isSameAs(*src->getMap()))
+        dst = Teuchos::rcp(new Tpetra_Vector(src->getMap()));
+      dst->assign(*src);
+    }
+
+    //! Albany applications
+    Teuchos::RCP<Application> app;
+
+    //! @name Data needed for apply()
+    //@{
+
+    //! Coefficients of df/dxdot, df/dx and df/dxdotdot
+    double alpha, beta, omega;
+
+    //! Current time
+    double time;
+
+    //! Velocity vector
+    Teuchos::RCP<Tpetra_Vector> xdot;
+
+    //! Acceleration vector
+    Teuchos::RCP<Tpetra_Vector> xdotdot;
+
+    //! Solution vector
+    Teuchos::RCP<Tpetra_Vector> x;
+
+    //! Scalar parameters
+    Teuchos::Array<ParamVec> scalar_params;
+
+    //@}
+
+  }; // class MatrixFreeJacobianOpT
+
+} // namespace Albany
+
+#endif // ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
@@ -8,6 +8,7 @@
 
 #include "Albany_ModelEvaluatorT.hpp"
 #include "Albany_DistributedParameterDerivativeOpT.hpp"
+#include "Albany_MatrixFreeJacobianOpT.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Tpetra_ConfigDefs.hpp"
@@ -35,7 +36,13 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
     : app(app_),
       supports_xdot(false),
       supports_xdotdot(false),
-      supplies_prec(app_->suppliesPreconditioner())
+      supplies_prec(app_->suppliesPreconditioner()),
+      reuse_symbolic_setup_(appParams->sublist("Problem").get(
+          "Reuse Symbolic Setup", false)),
+      matrix_free_jacobian_(appParams->sublist("Problem").get(
+          "Matrix-Free Jacobian", false)),
+      prec_update_interval_(appParams->sublist("Problem").get(
+          "Preconditioner Update Interval", 1))
 {
   Teuchos::RCP<Teuchos::FancyOStream> out =
       Teuchos::VerboseObjectBase::getDefaultOStream();
@@ -44,6 +51,14 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
   Teuchos::ParameterList& problemParams   = appParams->sublist("Problem");
   Teuchos::ParameterList& parameterParams = problemParams.sublist("Parameters");
 
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      prec_update_interval_ < 1,
+      Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error in Albany::ModelEvaluatorT: "
+          << "Preconditioner Update Interval must be >= 1, not "
+          << prec_update_interval_ << std::endl);
+
   num_param_vecs = parameterParams.get("Number of Parameter Vectors", 0);
   bool using_old_parameter_list = false;
   if (parameterParams.isType<int>("Number")) {
@@ -426,6 +441,11 @@ Albany::ModelEvaluatorT::getUpperBounds() const
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 Albany::ModelEvaluatorT::create_W_op() const
 {
+  if (matrix_free_jacobian_) {
+    const Teuchos::RCP<Tpetra_Operator> W =
+        Teuchos::rcp(new Albany::MatrixFreeJacobianOpT(app));
+    return Thyra::createLinearOp(W);
+  }
   const Teuchos::RCP<Tpetra_Operator> W =
       Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
   return Thyra::createLinearOp(W);
@@ -440,12 +460,9 @@ Albany::ModelEvaluatorT::create_W_prec() const
   Teuchos::RCP<Thyra::LinearOpBase<ST>> precOp_thyra =
       Thyra::createLinearOp(precOp);
 
-  Teuchos::RCP<Tpetra_Operator> Extra_W_crs_op =
-      Teuchos::nonnull(create_W()) ? ConverterT::getTpetraOperator(create_W()) :
-                                     Teuchos::null;
-
-  Extra_W_crs =
-      Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(Extra_W_crs_op, true);
+  // The preconditioner is built from an assembled Jacobian, also when W
+  // itself is matrix-free
+  Extra_W_crs = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
 
   W_prec->initializeRight(precOp_thyra);
   return W_prec;
@@ -750,9 +767,10 @@ Albany::ModelEvaluatorT::evalModelImpl(
 
   // Get preconditioner operator, if requested
   Teuchos::RCP<Tpetra_Operator> WPrec_out;
-  if (outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec)) {
-    // IKT, 12/19/16: need to verify that this is correct
-    Teuchos::RCP<Tpetra_Operator> WPrec_out = app->getPreconditionerT();
+  if (outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) &&
+      Teuchos::nonnull(outArgsT.get_W_prec())) {
+    WPrec_out = ConverterT::getTpetraOperator(
+        outArgsT.get_W_prec()->getNonconstRightPrecOp());
   }
 
 #ifdef WRITE_MASS_MATRIX_TO_MM_FILE
@@ -771,7 +789,7 @@ Albany::ModelEvaluatorT::evalModelImpl(
 
   // Cast W to a CrsMatrix, throw an exception if this fails
   const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
-      Teuchos::nonnull(W_op_outT) ?
+      Teuchos::nonnull(W_op_outT) && !matrix_free_jacobian_ ?
           Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(W_op_outT, true) :
           Teuchos::null;
 
@@ -789,6 +807,13 @@ Albany::ModelEvaluatorT::evalModelImpl(
   //
   bool f_already_computed = false;
 
+  // W operator, applied later by Tangent fills at the current point
+  if (Teuchos::nonnull(W_op_outT) && matrix_free_jacobian_) {
+    Teuchos::rcp_dynamic_cast<Albany::MatrixFreeJacobianOpT>(W_op_outT, true)
+        ->set(alpha, beta, omega, curr_time, x_dotT, x_dotdotT, xT,
+              sacado_param_vec);
+  }
+
   // W matrix
   if (Teuchos::nonnull(W_op_out_crsT)) {
     app->computeGlobalJacobianT(
@@ -803,6 +828,10 @@ Albany::ModelEvaluatorT::evalModelImpl(
         fT_out.get(),
         *W_op_out_crsT);
     f_already_computed = true;
+    jacobian_graph_version_ =
+        reuse_symbolic_setup_ ?
+            app->getDiscretization()->getGraphVersion() :
+            -1;
 #ifdef WRITE_MASS_MATRIX_TO_MM_FILE
     // IK, 4/24/15: write mass matrix to matrix market file
     // Warning: to read this in to MATLAB correctly, code must be run in serial.
@@ -827,7 +856,13 @@ Albany::ModelEvaluatorT::evalModelImpl(
         "colmap.mm", *Mass_crs->getColMap());
 #endif
   }
-  if (Teuchos::nonnull(WPrec_out)) {
+  // The preconditioner is only updated every prec_update_interval_ requests,
+  // or when it has not been computed yet
+  const bool update_prec =
+      Teuchos::nonnull(WPrec_out) &&
+      (prec_requests_++ % prec_update_interval_ == 0 ||
+       WPrec_out.get() != computed_prec_);
+  if (update_prec) {
     app->computeGlobalJacobianT(
         alpha,
         beta,
@@ -842,6 +877,7 @@ Albany::ModelEvaluatorT::evalModelImpl(
     f_already_computed = true;
 
     app->computeGlobalPreconditionerT(Extra_W_crs, WPrec_out);
+    computed_prec_ = WPrec_out.get();
   }
 
   // df/dp
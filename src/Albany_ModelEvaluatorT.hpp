@@ -85,6 +85,15 @@ class ModelEvaluatorT
 
   //@}
 
+  //! Graph version of the discretization when W_op was last computed.
+  //! Preconditioner factories may keep their symbolic setup while it does
+  //! not change. Negative if "Reuse Symbolic Setup" is off or the
+  //! discretization does not track its graph.
+  int
+  getJacobianGraphVersion() const {
+    return jacobian_graph_version_;
+  }
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST
@@ -182,6 +191,24 @@ class ModelEvaluatorT
   //! Model uses time integration (accelerations)
   bool supports_xdotdot;
 
+  //! Whether preconditioners may reuse symbolic setup on the same graph
+  bool reuse_symbolic_setup_;
+
+  //! See getJacobianGraphVersion()
+  mutable int jacobian_graph_version_{-1};
+
+  //! Whether W is applied by Tangent fills instead of being assembled
+  bool matrix_free_jacobian_;
+
+  //! Number of W_prec requests between preconditioner updates
+  int prec_update_interval_;
+
+  //! Number of W_prec requests so far
+  mutable int prec_requests_{0};
+
+  //! Preconditioner computed by the last update
+  mutable const Tpetra_Operator* computed_prec_{nullptr};
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST
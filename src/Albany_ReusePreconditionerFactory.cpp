@@ -0,0 +1,148 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_ReusePreconditionerFactory.hpp"
+#include "Albany_ModelEvaluatorT.hpp"
+
+#include "Thyra_DefaultPreconditioner.hpp"
+#include "utility/CounterMonitor.hpp"
+#include "utility/PerformanceContext.hpp"
+
+#ifdef ALBANY_IFPACK2
+#include "Ifpack2_Preconditioner.hpp"
+#endif
+
+Albany::ReusePreconditionerFactory::ReusePreconditionerFactory(
+    const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& factory,
+    const Teuchos::RCP<const ModelEvaluatorT>&                model)
+    : factory_(factory), model_(model)
+{
+}
+
+bool
+Albany::ReusePreconditionerFactory::isCompatible(
+    const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const
+{
+  return factory_->isCompatible(fwdOpSrc);
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+Albany::ReusePreconditionerFactory::createPrec() const
+{
+  return factory_->createPrec();
+}
+
+void
+Albany::ReusePreconditionerFactory::initializePrec(
+    const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+    Thyra::PreconditionerBase<ST>*                           prec,
+    const Thyra::ESupportSolveUse supportSolveUse) const
+{
+  util::CounterMonitor& cmonitor =
+      util::PerformanceContext::instance().counterMonitor();
+
+  const int  graph_version = model_->getJacobianGraphVersion();
+  const bool same_graph = graph_version >= 0 && graph_version == graph_version_;
+
+  if (same_graph == true) {
+    if (recompute(*fwdOpSrc, *prec) == true) {
+      *cmonitor["Preconditioner: Numeric Setups"] += 1;
+      return;
+    }
+  } else {
+    // Make the wrapped factory start over instead of reusing anything.
+    Thyra::DefaultPreconditioner<ST>* default_prec =
+        dynamic_cast<Thyra::DefaultPreconditioner<ST>*>(prec);
+    if (default_prec != nullptr) default_prec->uninitialize();
+    *cmonitor["Preconditioner: Symbolic Setups"] += 1;
+  }
+
+  factory_->initializePrec(fwdOpSrc, prec, supportSolveUse);
+  graph_version_ = graph_version;
+}
+
+bool
+Albany::ReusePreconditionerFactory::recompute(
+    const Thyra::LinearOpSourceBase<ST>& fwdOpSrc,
+    Thyra::PreconditionerBase<ST>&       prec) const
+{
+#ifdef ALBANY_IFPACK2
+  typedef Ifpack2::Preconditioner<ST, Tpetra_LO, Tpetra_GO, KokkosNode>
+      Ifpack2_Preconditioner;
+
+  const Teuchos::RCP<Thyra::LinearOpBase<ST>> prec_op =
+      prec.getNonconstUnspecifiedPrecOp();
+  if (Teuchos::is_null(prec_op)) return false;
+
+  const Teuchos::RCP<Ifpack2_Preconditioner> ifpack2_prec =
+      Teuchos::rcp_dynamic_cast<Ifpack2_Preconditioner>(
+          ConverterT::getTpetraOperator(prec_op));
+  if (Teuchos::is_null(ifpack2_prec)) return false;
+
+  // The symbolic setup refers to the matrix object, which has to be the
+  // same one with new values.
+  const Teuchos::RCP<const Tpetra_RowMatrix> matrix =
+      Teuchos::rcp_dynamic_cast<const Tpetra_RowMatrix>(
+          ConverterT::getConstTpetraOperator(fwdOpSrc.getOp()));
+  if (Teuchos::is_null(matrix) ||
+      matrix.get() != ifpack2_prec->getMatrix().get()) {
+    return false;
+  }
+
+  ifpack2_prec->compute();
+  return true;
+#else
+  return false;
+#endif
+}
+
+void
+Albany::ReusePreconditionerFactory::uninitializePrec(
+    Thyra::PreconditionerBase<ST>*                     prec,
+    Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+    Thyra::ESupportSolveUse*                           supportSolveUse) const
+{
+  factory_->uninitializePrec(prec, fwdOpSrc, supportSolveUse);
+  graph_version_ = -1;
+}
+
+void
+Albany::ReusePreconditionerFactory::setParameterList(
+    const Teuchos::RCP<Teuchos::ParameterList>& paramList)
+{
+  factory_->setParameterList(paramList);
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::ReusePreconditionerFactory::getNonconstParameterList()
+{
+  return factory_->getNonconstParameterList();
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::ReusePreconditionerFactory::unsetParameterList()
+{
+  return factory_->unsetParameterList();
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::ReusePreconditionerFactory::getParameterList() const
+{
+  return factory_->getParameterList();
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::ReusePreconditionerFactory::getValidParameters() const
+{
+  return factory_->getValidParameters();
+}
+
+std::string
+Albany::ReusePreconditionerFactory::description() const
+{
+  return "Albany::ReusePreconditionerFactory{" + factory_->description() +
+         "}";
+}
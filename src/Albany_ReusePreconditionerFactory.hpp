@@ -0,0 +1,120 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_REUSEPRECONDITIONERFACTORY_HPP
+#define ALBANY_REUSEPRECONDITIONERFACTORY_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_AbstractFactory.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+namespace Albany {
+
+class ModelEvaluatorT;
+
+/*! Decorates a Stratimikos preconditioner factory so that the symbolic
+ *  setup of the preconditioner is kept across Newton and time steps while
+ *  the Jacobian graph does not change, as reported by
+ *  ModelEvaluatorT::getJacobianGraphVersion(). Only the numeric phase is
+ *  then redone:
+ *  - Ifpack2: only compute() is called on the existing preconditioner.
+ *  - Other factories (e.g. MueLu) are handed the existing preconditioner,
+ *    so their own reuse options, e.g. "reuse: type" for MueLu, apply.
+ *  When the graph version changes, the preconditioner is discarded and set
+ *  up from scratch.
+ */
+class ReusePreconditionerFactory : public Thyra::PreconditionerFactoryBase<ST> {
+ public:
+  ReusePreconditionerFactory(
+      const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& factory,
+      const Teuchos::RCP<const ModelEvaluatorT>& model);
+
+  /** \name Overridden from Thyra::PreconditionerFactoryBase<ST> . */
+  //@{
+
+  bool
+  isCompatible(const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const;
+
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+  createPrec() const;
+
+  void
+  initializePrec(
+      const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+      Thyra::PreconditionerBase<ST>* prec,
+      const Thyra::ESupportSolveUse supportSolveUse) const;
+
+  void
+  uninitializePrec(
+      Thyra::PreconditionerBase<ST>* prec,
+      Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+      Thyra::ESupportSolveUse* supportSolveUse) const;
+
+  //@}
+
+  /** \name Overridden from Teuchos::ParameterListAcceptor . */
+  //@{
+
+  void
+  setParameterList(const Teuchos::RCP<Teuchos::ParameterList>& paramList);
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  getNonconstParameterList();
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  unsetParameterList();
+
+  Teuchos::RCP<const Teuchos::ParameterList>
+  getParameterList() const;
+
+  Teuchos::RCP<const Teuchos::ParameterList>
+  getValidParameters() const;
+
+  //@}
+
+  std::string
+  description() const;
+
+ private:
+  //! Numeric-only setup of an existing preconditioner, false if not possible
+  bool
+  recompute(
+      const Thyra::LinearOpSourceBase<ST>& fwdOpSrc,
+      Thyra::PreconditionerBase<ST>& prec) const;
+
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> factory_;
+
+  Teuchos::RCP<const ModelEvaluatorT> model_;
+
+  //! Graph version of the last symbolic setup, -1 if none
+  mutable int graph_version_{-1};
+};
+
+/*! Stratimikos strategy factory creating a ReusePreconditionerFactory
+ *  around a default-constructed Impl.
+ */
+template <typename Impl>
+class ReusePreconditionerAbstractFactory
+    : public Teuchos::AbstractFactory<Thyra::PreconditionerFactoryBase<ST>> {
+ public:
+  explicit ReusePreconditionerAbstractFactory(
+      const Teuchos::RCP<const ModelEvaluatorT>& model)
+      : model_(model) {}
+
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>
+  create() const {
+    return Teuchos::rcp(
+        new ReusePreconditionerFactory(Teuchos::rcp(new Impl), model_));
+  }
+
+ private:
+  Teuchos::RCP<const ModelEvaluatorT> model_;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_REUSEPRECONDITIONERFACTORY_HPP
@@ -17,6 +17,11 @@
 #endif
 #include "Albany_ModelFactory.hpp"
 #include "Albany_PiroObserverT.hpp"
+#include "Albany_ReusePreconditionerFactory.hpp"
+#if defined(ALBANY_MOR) && defined(ALBANY_EPETRA)
+#include "MOR_ObserverFactory.hpp"
+#include "MOR_TpetraSnapshotCollectionObserver.hpp"
+#endif
 
 #include "Piro_ProviderBase.hpp"
 
@@ -33,6 +38,7 @@
 
 #ifdef ALBANY_MUELU
 #include "Stratimikos_MueLuHelpers.hpp"
+#include "Thyra_MueLuPreconditionerFactory.hpp"
 #endif /* ALBANY_MUELU */
 
 #ifdef ALBANY_TEKO
@@ -74,6 +80,7 @@
 #include "Teuchos_XMLParameterListHelpers.hpp"
 #include "Teuchos_YamlParameterListHelpers.hpp"
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 
 #if defined(ALBANY_EPETRA) && defined(ALBANY_RYTHMOS)
 #include "Rythmos_IntegrationObserverBase.hpp"
@@ -81,9 +88,61 @@
 
 #include "Albany_Application.hpp"
 #include "Albany_Utils.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "utility/PerformanceContext.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
 
 extern bool TpetraBuild;
 
+namespace {
+
+// Keeps the fills of the workset size autotuning out of the global fill
+// timers and of the counters of util::PerformanceContext, so that the
+// summaries only report the actual solve.
+class SuspendedFillMonitors {
+ public:
+  SuspendedFillMonitors()
+      : timers_(Teuchos::tuple<std::string>(
+            "> Albany Fill: Residual", "> Albany Fill: Jacobian",
+            "> Albany Fill: Jacobian Export")) {
+    for (auto const& name : timers_) {
+      // Registers the timer if no fill has run yet
+      Teuchos::TimeMonitor::getNewTimer(name);
+      Teuchos::TimeMonitor::disableTimer(name);
+    }
+    for (auto const& item :
+         util::PerformanceContext::instance().counterMonitor().items())
+      counts_[item.first] = item.second->value();
+  }
+
+  ~SuspendedFillMonitors() {
+    for (auto const& name : timers_) Teuchos::TimeMonitor::enableTimer(name);
+
+    util::CounterMonitor& cmonitor =
+        util::PerformanceContext::instance().counterMonitor();
+    std::vector<std::string> added;
+    for (auto const& item : cmonitor.items()) {
+      auto const count = counts_.find(item.first);
+      if (count == counts_.end())
+        added.push_back(item.first);
+      else
+        item.second->set(count->second);
+    }
+    for (auto const& name : added) cmonitor.remove(name);
+  }
+
+ private:
+  Teuchos::Array<std::string> timers_;
+  std::map<std::string, util::Counter::counter_type> counts_;
+};
+
+}  // namespace
+
 #if defined(ALBANY_EPETRA)
 namespace Albany {
 
@@ -382,6 +441,7 @@ Albany::SolverFactory::createAndGetAlbanyApp(
   RCP<Albany::Application> app;
 
   if (createAlbanyApp) {
+    autotuneWorksetSize(appCommT, initial_guess);
     app = rcp(new Albany::Application(appCommT, appParams, initial_guess, is_schwarz_));
 
     // Pass back albany app so that interface beyond ModelEvaluator can be used.
@@ -539,13 +599,24 @@ Albany::SolverFactory::createThyraSolverAndGetAlbanyApp(
 
 namespace {
 
+// If reuseModel is given, the preconditioner keeps its symbolic setup while
+// the Jacobian graph of the model does not change.
 void
-enableIfpack2(Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder) {
+enableIfpack2(
+    Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder,
+    const Teuchos::RCP<const Albany::ModelEvaluatorT>& reuseModel =
+        Teuchos::null) {
 #ifdef ALBANY_IFPACK2
   typedef Thyra::PreconditionerFactoryBase<ST> Base;
   typedef Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> Impl;
-  linearSolverBuilder.setPreconditioningStrategyFactory(
-      Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
+  if (Teuchos::nonnull(reuseModel)) {
+    linearSolverBuilder.setPreconditioningStrategyFactory(
+        rcp(new Albany::ReusePreconditionerAbstractFactory<Impl>(reuseModel)),
+        "Ifpack2");
+  } else {
+    linearSolverBuilder.setPreconditioningStrategyFactory(
+        Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
+  }
 #endif
 }
 
@@ -553,11 +624,51 @@ void
 enableMueLu(
     Teuchos::RCP<Albany::Application>& albanyApp,
     const Teuchos::RCP<Teuchos::ParameterList>& stratList,
-    Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder) {
+    Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder,
+    const Teuchos::RCP<const Albany::ModelEvaluatorT>& reuseModel =
+        Teuchos::null) {
 #ifdef ALBANY_MUELU
-  Stratimikos::enableMueLu<LO, Tpetra_GO, KokkosNode>(linearSolverBuilder);
+  if (Teuchos::nonnull(reuseModel)) {
+    typedef Thyra::MueLuPreconditionerFactory<ST, LO, Tpetra_GO, KokkosNode>
+        Impl;
+    linearSolverBuilder.setPreconditioningStrategyFactory(
+        rcp(new Albany::ReusePreconditionerAbstractFactory<Impl>(reuseModel)),
+        "MueLu");
+  } else {
+    Stratimikos::enableMueLu<LO, Tpetra_GO, KokkosNode>(linearSolverBuilder);
+  }
 #endif
 }
+
+// With MOR, snapshot collection decorates the observer (Tpetra analogue of
+// NOXObserverFactory). Not used with mesh adaptation, where the snapshots
+// would live on different maps.
+Teuchos::RCP<Piro::ObserverBase<double>>
+createPiroObserverT(
+    const Teuchos::RCP<Albany::Application>&              app,
+    const Teuchos::RCP<const Thyra::ModelEvaluator<ST>>& model) {
+  Teuchos::RCP<Piro::ObserverBase<double>> result =
+      rcp(new Albany::PiroObserverT(app, model));
+#if defined(ALBANY_MOR) && defined(ALBANY_EPETRA)
+  if (app->getDiscretization()->supportsMOR()) {
+    result = app->getMorFacade()->observerFactory()->create(result);
+  }
+#endif
+  return result;
+}
+
+// Whether "Model Order Reduction/Snapshot Collection" is activated
+bool
+collectsMorSnapshots(const Teuchos::ParameterList& problemParams) {
+  if (!problemParams.isSublist("Model Order Reduction")) return false;
+  const Teuchos::ParameterList& morParams =
+      problemParams.sublist("Model Order Reduction");
+  if (!morParams.isSublist("Snapshot Collection")) return false;
+  const Teuchos::ParameterList& snapParams =
+      morParams.sublist("Snapshot Collection");
+  return snapParams.isParameter("Activate") &&
+         snapParams.get<bool>("Activate");
+}
 }  // namespace
 
 Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>>
@@ -856,10 +967,18 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
   if (Teuchos::nonnull(modelT_->get_W_factory())) {
     modelWithSolveT = modelT_;
   } else {
+    // Preconditioner symbolic setup reuse, see ReusePreconditionerFactory
+    const bool reuseSymbolic =
+        appParams->sublist("Problem").get("Reuse Symbolic Setup", false);
+    const RCP<const Albany::ModelEvaluatorT> reuseModel =
+        reuseSymbolic ?
+            Teuchos::rcp_dynamic_cast<const Albany::ModelEvaluatorT>(modelT_) :
+            Teuchos::null;
+
     // Setup linear solver
     Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
-    enableIfpack2(linearSolverBuilder);
-    enableMueLu(albanyApp, stratList, linearSolverBuilder);
+    enableIfpack2(linearSolverBuilder, reuseModel);
+    enableMueLu(albanyApp, stratList, linearSolverBuilder, reuseModel);
 #ifdef ALBANY_TEKO
     Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
 #endif
@@ -877,6 +996,11 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
   Piro::SolverFactory piroFactory;
 
   if (solMgrT->isAdaptive()) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        collectsMorSnapshots(appParams->sublist("Problem")),
+        std::logic_error,
+        "Error! MOR snapshot collection is not supported with mesh "
+        "adaptation.\n");
     if (TpetraBuild) {
       observerT_ = rcp(new PiroObserverT(app, modelWithSolveT));
       return piroFactory.createSolver<ST, LO, Tpetra_GO, KokkosNode>(
@@ -891,7 +1015,7 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
 #endif
   } else {
     if (TpetraBuild) {
-      observerT_ = rcp(new PiroObserverT(app, modelWithSolveT));
+      observerT_ = createPiroObserverT(app, modelWithSolveT);
       return piroFactory.createSolver<ST, LO, Tpetra_GO, KokkosNode>(
           piroParams, modelWithSolveT, Teuchos::null, observerT_);
     }
@@ -945,6 +1069,7 @@ Albany::SolverFactory::createAlbanyAppAndModelT(
     const Teuchos::RCP<const Tpetra_Vector>& initial_guess,
     const bool createAlbanyApp) {
   if (createAlbanyApp) {
+    autotuneWorksetSize(appComm, initial_guess);
     // Create application
     albanyApp = rcp(new Albany::Application(appComm, appParams, initial_guess, is_schwarz_));
     //  albanyApp = rcp(new Albany::ApplicationT(appComm, appParams,
@@ -998,6 +1123,16 @@ Albany::SolverFactory::createAlbanyAppAndModelT(
   return modelFactory.createT();
 }
 
+void
+Albany::SolverFactory::finalizeObserverT() const {
+#if defined(ALBANY_MOR) && defined(ALBANY_EPETRA)
+  const RCP<MOR::TpetraSnapshotCollectionObserver> snapshotObserver =
+      Teuchos::rcp_dynamic_cast<MOR::TpetraSnapshotCollectionObserver>(
+          observerT_);
+  if (Teuchos::nonnull(snapshotObserver)) snapshotObserver->finalize();
+#endif
+}
+
 int
 Albany::SolverFactory::checkSolveTestResultsT(
     int response_index, int parameter_index, const Tpetra_Vector* g,
@@ -1295,6 +1430,120 @@ Albany::SolverFactory::scaledCompare(
   return !ok;
 }
 
+void
+Albany::SolverFactory::autotuneWorksetSize(
+    const Teuchos::RCP<const Teuchos_Comm>& appComm,
+    const Teuchos::RCP<const Tpetra_Vector>& initial_guess) {
+  ParameterList& discParams = appParams->sublist("Discretization");
+  if (discParams.get("Autotune Workset Size", false) == false) return;
+
+  Teuchos::Array<int> sizes = discParams.get<Teuchos::Array<int>>(
+      "Autotune Workset Sizes", Teuchos::tuple<int>(32, 128, 512));
+  int const num_fills = discParams.get("Autotune Fills", 3);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      sizes.size() == 0 || num_fills < 1,
+      Teuchos::Exceptions::InvalidParameter,
+      "Error in Albany::SolverFactory: Autotune Workset Size needs at least "
+      "one candidate size and Autotune Fills >= 1.\n");
+
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: Workset Size Autotuning");
+
+  std::sort(sizes.begin(), sizes.end());
+  sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+
+  int best_size = sizes[0];
+  double best_time = std::numeric_limits<double>::max();
+  int max_block_cells = std::numeric_limits<int>::max();
+
+  SuspendedFillMonitors const suspended_monitors;
+
+  // Every candidate costs a full application setup, mesh input included,
+  // since the workset size is the STK bucket capacity. The search stops as
+  // soon as a size cannot give different worksets or is slower than the
+  // best so far (the fill time is taken to be unimodal in the size).
+  for (int i = 0; i < sizes.size(); ++i) {
+    int const size = sizes[i];
+    if (i > 0 && sizes[i - 1] >= max_block_cells) break;
+
+    // Each candidate gets its own application, since the workset size is
+    // the STK bucket capacity and the cell dimension of every MDField.
+    RCP<ParameterList> const trialParams = rcp(new ParameterList(*appParams));
+    ParameterList& trialDisc = trialParams->sublist("Discretization");
+    trialDisc.set("Workset Size", size);
+    trialDisc.set("Autotune Workset Size", false);
+    trialDisc.remove("Exodus Output File Name", false);
+    // Only the plain fill is timed, and nothing is recorded for the solve
+    ParameterList& trialProblem = trialParams->sublist("Problem");
+    trialProblem.set("Linear Jacobian Reuse", false);
+    trialProblem.set("Frozen Element Jacobians", false);
+    trialProblem.set("Profile Evaluators", false);
+
+    RCP<Albany::Application> const app = rcp(new Albany::Application(
+        appComm, trialParams, initial_guess, is_schwarz_));
+
+    RCP<const Tpetra_MultiVector> const soln =
+        app->getAdaptSolMgrT()->getInitialSolution();
+    RCP<const Tpetra_Vector> const x = soln->getVector(0);
+    RCP<const Tpetra_Vector> const xdot =
+        soln->getNumVectors() > 1 ? soln->getVector(1) : Teuchos::null;
+    double const alpha = Teuchos::nonnull(xdot) ? 1.0 : 0.0;
+
+    Tpetra_Vector f(app->getMapT());
+    Tpetra_CrsMatrix jac(app->getJacobianGraphT());
+    Teuchos::Array<ParamVec> const p;
+
+    // The first fill includes the evaluator setup and is not timed.
+    app->computeGlobalJacobianT(
+        alpha, 1.0, 0.0, 0.0, xdot.get(), NULL, *x, p, &f, jac);
+
+    Teuchos::Time timer("Workset Size Autotuning");
+    timer.start(true);
+    for (int fill = 0; fill < num_fills; ++fill) {
+      app->computeGlobalResidualT(0.0, xdot.get(), NULL, *x, p, f);
+      app->computeGlobalJacobianT(
+          alpha, 1.0, 0.0, 0.0, xdot.get(), NULL, *x, p, &f, jac);
+    }
+    timer.stop();
+
+    // The slowest rank decides
+    double const local_time = timer.totalElapsedTime();
+    double time = local_time;
+    Teuchos::reduceAll(
+        *appComm, Teuchos::REDUCE_MAX, local_time, Teuchos::ptr(&time));
+
+    *out << "Workset size autotuning: size " << size << ", " << time / num_fills
+         << " s per residual and Jacobian fill" << std::endl;
+
+    if (i == 0) {
+      // Larger sizes than the largest element block on any rank only
+      // repeat the buckets of the smallest size that holds it.
+      Albany::AbstractDiscretization const& disc = *app->getDiscretization();
+      auto const& wsElNodeEqID = disc.getWsElNodeEqID();
+      auto const& wsEBNames = disc.getWsEBNames();
+      std::map<std::string, int> block_cells;
+      for (int ws = 0; ws < wsElNodeEqID.size(); ++ws)
+        block_cells[wsEBNames[ws]] += wsElNodeEqID[ws].dimension(0);
+      int local_max = 0;
+      for (auto const& block : block_cells)
+        local_max = std::max(local_max, block.second);
+      Teuchos::reduceAll(
+          *appComm, Teuchos::REDUCE_MAX, local_max,
+          Teuchos::ptr(&max_block_cells));
+    }
+
+    if (time < best_time) {
+      best_time = time;
+      best_size = size;
+    } else {
+      break;
+    }
+  }
+
+  discParams.set("Workset Size", best_size);
+  *out << "Workset size autotuning: using Workset Size = " << best_size
+       << std::endl;
+}
+
 void
 Albany::SolverFactory::setSolverParamDefaults(
     ParameterList* appParams_, int myRank) {
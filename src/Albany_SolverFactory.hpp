@@ -150,6 +150,15 @@ class SolverFactory {
   void
   setSolverParamDefaults(Teuchos::ParameterList* appParams, int myRank);
 
+  //! If "Autotune Workset Size" is set in the Discretization list, time
+  //! fills of trial applications for increasing candidate workset sizes,
+  //! stopping at the first slower one or once the sizes exceed the largest
+  //! element block, and set "Workset Size" to the fastest one
+  void
+  autotuneWorksetSize(
+      const Teuchos::RCP<const Teuchos_Comm>& appComm,
+      const Teuchos::RCP<const Tpetra_Vector>& initial_guess);
+
   Teuchos::RCP<const Teuchos::ParameterList>
   getValidRegressionResultsParameters() const;
 
@@ -196,6 +205,11 @@ class SolverFactory {
     return observerT_;
   };
 
+  /** \brief Lets the observer write what it collected during the solve, such
+   * as the MOR snapshot basis. Call once the solve has ended. */
+  void
+  finalizeObserverT() const;
+
 #if defined(ALBANY_EPETRA)
   /** \brief Function that does regression testing for SG runs. */
   int
@@ -8,6 +8,8 @@
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
+#include <algorithm>
+
 Albany::StateManager::StateManager()
     : stateVarsAreAllocated(false), stateInfo(Teuchos::rcp(new StateInfoStruct))
 {
@@ -863,6 +865,39 @@ Albany::StateManager::setStateArrays(Albany::StateArrays& sa)
   return;
 }
 
+namespace {
+
+// Copy the current values of a state into its old-state buffer for all
+// worksets. The map lookups are done once per workset and the data is
+// copied as one contiguous block.
+void
+copyToOldState(
+    Albany::StateArrayVec& sav,
+    const std::string&     stateName,
+    const std::string&     stateName_old)
+{
+  for (int ws = 0; ws < sav.size(); ws++) {
+    const auto state     = sav[ws].find(stateName);
+    const auto state_old = sav[ws].find(stateName_old);
+    if (state == sav[ws].end() || state_old == sav[ws].end()) continue;
+
+    const Albany::MDArray& src = state->second;
+    Albany::MDArray&       dst = state_old->second;
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        src.size() != dst.size(),
+        std::logic_error,
+        "Error: State " << stateName << " and " << stateName_old
+                        << " differ in size in state manager." << std::endl);
+    if (src.size() == 0) continue;
+    std::copy(
+        src.contiguous_data(),
+        src.contiguous_data() + src.size(),
+        dst.contiguous_data());
+  }
+}
+
+}  // namespace
+
 void
 Albany::StateManager::updateStates()
 {
@@ -871,11 +906,9 @@ Albany::StateManager::updateStates()
   ALBANY_ASSERT(stateVarsAreAllocated == true);
 
   // Get states from STK mesh
-  Albany::StateArrays&   sa              = disc->getStateArrays();
-  Albany::StateArrayVec& esa             = sa.elemStateArrays;
-  Albany::StateArrayVec& nsa             = sa.nodeStateArrays;
-  int                    numElemWorksets = esa.size();
-  int                    numNodeWorksets = nsa.size();
+  Albany::StateArrays&   sa  = disc->getStateArrays();
+  Albany::StateArrayVec& esa = sa.elemStateArrays;
+  Albany::StateArrayVec& nsa = sa.nodeStateArrays;
 
   // For each workset, loop over registered states
 
@@ -886,26 +919,20 @@ Albany::StateManager::updateStates()
 
       switch ((*stateInfo)[i]->entity) {
         case Albany::StateStruct::NodalDataToElemNode:
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j                  = 0; j < nsa[ws][stateName].size(); j++)
-              nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+          copyToOldState(nsa, stateName, stateName_old);
 
         case Albany::StateStruct::WorksetValue:
         case Albany::StateStruct::ElemData:
         case Albany::StateStruct::QuadPoint:
         case Albany::StateStruct::ElemNode:
 
-          for (int ws = 0; ws < numElemWorksets; ws++)
-            for (int j                  = 0; j < esa[ws][stateName].size(); j++)
-              esa[ws][stateName_old][j] = esa[ws][stateName][j];
+          copyToOldState(esa, stateName, stateName_old);
 
           break;
 
         case Albany::StateStruct::NodalData:
 
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j                  = 0; j < nsa[ws][stateName].size(); j++)
-              nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+          copyToOldState(nsa, stateName, stateName_old);
 
           break;
 
@@ -21,6 +21,8 @@
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dirichlet.hpp"
 
+#include <vector>
+
 #if defined(ALBANY_DTK)
 #include "DTK_STKMeshHelpers.hpp"
 #include "DTK_STKMeshManager.hpp"
@@ -138,6 +140,34 @@ protected:
 
   int
   coupled_app_index_;
+
+  // Element of the coupled mesh that contains a node of the coupled node
+  // set, given by its overlap local node ids, and the values of its shape
+  // functions at the node.
+  struct CoupledPoint
+  {
+    std::vector<LO>
+    local_nodes;
+
+    std::vector<double>
+    basis_values;
+  };
+
+  void
+  updateCoupledPoints();
+
+  std::vector<CoupledPoint>
+  coupled_points_;
+
+  int
+  coupled_dimension_{0};
+
+  // Mesh versions for which coupled_points_ were computed
+  int
+  this_mesh_version_{-1};
+
+  int
+  coupled_mesh_version_{-1};
 };
 
 //
@@ -7,11 +7,14 @@
 #include "Albany_Application.hpp"
 #include "Albany_GenericSTKMeshStruct.hpp"
 #include "Albany_STKDiscretization.hpp"
+#include "BoxGrid.hpp"
 #include "MiniTensor.h"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Teuchos_TestForException.hpp"
 
+#include <sstream>
+
 #if defined(ALBANY_DTK)
 #include "Albany_OrdinarySTKFieldContainer.hpp"
 #endif
@@ -70,13 +73,15 @@ SchwarzBC_Base(Teuchos::ParameterList & p) :
 }
 
 //
-//
+// Locate the nodes of the node set of this application coupled to the
+// coupled application in the coupled mesh. Candidate elements come from
+// a grid over the element bounding boxes. The locations are reused until
+// either mesh changes.
 //
 template<typename EvalT, typename Traits>
-template<typename T>
 void
 SchwarzBC_Base<EvalT, Traits>::
-computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
+updateCoupledPoints()
 {
   auto const
   coupled_app_index = getCoupledAppIndex();
@@ -84,16 +89,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
   Albany::Application const &
   coupled_app = getApplication(coupled_app_index);
 
-  Teuchos::RCP<Tpetra_Vector const>
-  coupled_solution = coupled_app.getX();
-
-  if (coupled_solution == Teuchos::null) {
-    x_val = 0.0;
-    y_val = 0.0;
-    z_val = 0.0;
-    return;
-  }
-
   auto const
   this_app_index = getThisAppIndex();
 
@@ -113,6 +108,30 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
   coupled_stk_disc =
       static_cast<Albany::STKDiscretization *>(coupled_disc.get());
 
+  std::string const &
+  coupled_nodeset_name = this_app.getNodesetName(coupled_app_index);
+
+  std::vector<double *> const &
+  ns_coord =
+      this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name)->second;
+
+  std::vector<GO> const &
+  ns_gids =
+      this_stk_disc->getNodeSetGIDs().find(coupled_nodeset_name)->second;
+
+  auto const
+  this_mesh_version = this_stk_disc->getMeshVersion();
+
+  auto const
+  coupled_mesh_version = coupled_stk_disc->getMeshVersion();
+
+  bool const
+  is_current = coupled_points_.size() == ns_coord.size() &&
+      this_mesh_version == this_mesh_version_ &&
+      coupled_mesh_version == coupled_mesh_version_;
+
+  if (is_current == true) return;
+
   auto &
   coupled_gms = dynamic_cast<Albany::GenericSTKMeshStruct &>
       (*(coupled_stk_disc->getSTKMeshStruct()));
@@ -171,27 +190,9 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
   auto const
   coupled_node_count = coupled_cell_topology_data.node_count;
 
-  std::string const &
-  coupled_nodeset_name = this_app.getNodesetName(coupled_app_index);
-
-  std::vector<double *> const &
-  ns_coord =
-      this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name)->second;
-
   auto const &
   ws_elem_to_node_id = coupled_stk_disc->getWsElNodeID();
 
-  std::vector<minitensor::Vector<double>>
-  coupled_element_nodes(coupled_node_count);
-
-  std::vector<minitensor::Vector<double>>
-  coupled_element_solution(coupled_node_count);
-
-  for (auto i = 0; i < coupled_node_count; ++i) {
-    coupled_element_nodes[i].set_dimension(coupled_dimension);
-    coupled_element_solution[i].set_dimension(coupled_dimension);
-  }
-
   // This tolerance is used for geometric approximations. It will be used
   // to determine whether a node of this_app is inside an element of
   // coupled_app within that tolerance.
@@ -236,25 +237,79 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
     break;
   }
 
-  double * const
-  coord = ns_coord[ns_node];
+  Teuchos::ArrayRCP<double> const &
+  coupled_coordinates = coupled_stk_disc->getCoordinates();
 
-  minitensor::Vector<double>
-  point;
+  Teuchos::RCP<Tpetra_Map const>
+  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
 
-  point.set_dimension(coupled_dimension);
+  // Bounding boxes of the coupled elements, padded so that they contain
+  // the points accepted by the parametric test below.
+  std::vector<std::pair<int, int>>
+  elements;
 
-  point.fill(coord);
+  std::vector<double>
+  box_lo;
 
-  // Determine the element that contains this point.
-  Teuchos::ArrayRCP<double> const &
-  coupled_coordinates = coupled_stk_disc->getCoordinates();
+  std::vector<double>
+  box_hi;
 
-  Teuchos::ArrayRCP<ST const>
-  coupled_solution_view = coupled_solution->get1dView();
+  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
 
-  Teuchos::RCP<Tpetra_Map const>
-  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
+    std::string const &
+    coupled_element_block = coupled_ws_eb_names[workset];
+
+    bool const
+    block_names_differ = coupled_element_block != coupled_block_name;
+
+    if (use_block == true && block_names_differ == true) continue;
+
+    auto const
+    elements_per_workset = ws_elem_to_node_id[workset].size();
+
+    for (auto element = 0; element < elements_per_workset; ++element) {
+
+      minitensor::Vector<double>
+      element_lo(coupled_dimension);
+
+      minitensor::Vector<double>
+      element_hi(coupled_dimension);
+
+      for (auto node = 0; node < coupled_node_count; ++node) {
+
+        auto const
+        global_node_id = ws_elem_to_node_id[workset][element][node];
+
+        auto const
+        local_node_id =
+            coupled_overlap_node_map->getLocalElement(global_node_id);
+
+        double * const
+        pcoord = &(coupled_coordinates[coupled_dimension * local_node_id]);
+
+        for (auto i = 0; i < coupled_dimension; ++i) {
+          if (node == 0 || pcoord[i] < element_lo(i)) element_lo(i) = pcoord[i];
+          if (node == 0 || pcoord[i] > element_hi(i)) element_hi(i) = pcoord[i];
+        }
+
+      } // node loop
+
+      double const
+      pad = tolerance * minitensor::norm_infinity(element_hi - element_lo);
+
+      for (auto i = 0; i < coupled_dimension; ++i) {
+        box_lo.push_back(element_lo(i) - pad);
+        box_hi.push_back(element_hi(i) + pad);
+      }
+
+      elements.push_back(std::make_pair(workset, element));
+
+    } // element loop
+
+  } // workset loop
+
+  BoxGrid
+  grid(coupled_dimension, box_lo, box_hi);
 
   // We do this element by element
   auto const
@@ -272,10 +327,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
       number_points,
       parametric_dimension);
 
-  for (auto j = 0; j < parametric_dimension; ++j) {
-    parametric_point(0, 0, j) = 0.0;
-  }
-
   // Container for the physical point
   Kokkos::DynRankView<RealType, PHX::Device>
   physical_coordinates(
@@ -284,10 +335,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
       number_points,
       coupled_dimension);
 
-  for (auto i = 0; i < coupled_dimension; ++i) {
-    physical_coordinates(0, 0, i) = point(i);
-  }
-
   // Container for the physical nodal coordinates
   Kokkos::DynRankView<RealType, PHX::Device>
   nodal_coordinates(
@@ -296,23 +343,46 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
       coupled_node_count,
       coupled_dimension);
 
-  bool
-  found = false;
+  // Container for the values of the shape functions
+  Kokkos::DynRankView<RealType, PHX::Device>
+  basis_values("basis", coupled_node_count, number_points);
 
-  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
+  // Another container for the parametric coordinates. Needed because above
+  // it is required that parametric_points has rank 3 for mapToReferenceFrame
+  // but here basis->getValues requires a rank 2 view :(
+  Kokkos::DynRankView<RealType, PHX::Device>
+  pp_reduced("par_point", number_points, parametric_dimension);
 
-    std::string const &
-    coupled_element_block = coupled_ws_eb_names[workset];
+  std::vector<int>
+  candidates;
 
-    bool const
-    block_names_differ = coupled_element_block != coupled_block_name;
+  std::vector<LO>
+  local_nodes(coupled_node_count);
 
-    if (use_block == true && block_names_differ == true) continue;
+  coupled_points_.clear();
+  coupled_points_.resize(ns_coord.size());
 
-    auto const
-    elements_per_workset = ws_elem_to_node_id[workset].size();
+  for (auto ns_node = 0; ns_node < ns_coord.size(); ++ns_node) {
 
-    for (auto element = 0; element < elements_per_workset; ++element) {
+    double * const
+    coord = ns_coord[ns_node];
+
+    for (auto i = 0; i < coupled_dimension; ++i) {
+      physical_coordinates(0, 0, i) = coord[i];
+    }
+
+    grid.getCandidates(coord, candidates);
+
+    bool
+    found = false;
+
+    for (auto candidate : candidates) {
+
+      auto const
+      workset = elements[candidate].first;
+
+      auto const
+      element = elements[candidate].second;
 
       for (auto node = 0; node < coupled_node_count; ++node) {
 
@@ -323,23 +393,14 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
         local_node_id =
             coupled_overlap_node_map->getLocalElement(global_node_id);
 
-        double * const
-        pcoord = &(coupled_coordinates[coupled_dimension * local_node_id]);
-
-        coupled_element_nodes[node].fill(pcoord);
+        local_nodes[node] = local_node_id;
 
-        for (auto i = 0; i < coupled_dimension; ++i) {
-          coupled_element_solution[node](i) =
-              coupled_solution_view[coupled_dimension * local_node_id + i];
-        } // dimension loop
-
-      } // node loop
-
-      for (auto i = 0; i < coupled_node_count; ++i) {
         for (auto j = 0; j < coupled_dimension; ++j) {
-          nodal_coordinates(0, i, j) = coupled_element_nodes[i](j);
+          nodal_coordinates(0, node, j) =
+              coupled_coordinates[coupled_dimension * local_node_id + j];
         }
-      }
+
+      } // node loop
 
       // Get parametric coordinates
       Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(
@@ -362,38 +423,97 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
         break;
       }
 
-    } // element loop
+    } // candidate loop
+
+    if (found == false) {
+      std::ostringstream
+      point;
 
-    if (found == true) {
-      break;
+      for (auto i = 0; i < coupled_dimension; ++i) {
+        point << (i == 0 ? "(" : ", ") << coord[i];
+      }
+      point << ")";
+
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true,
+          std::runtime_error,
+          "\nERROR: " << __PRETTY_FUNCTION__ << '\n' <<
+          "Node " << ns_gids[ns_node] << " at " << point.str() <<
+          " of node set " << coupled_nodeset_name << '\n' <<
+          "of application " << this_app_name <<
+          " is in no element of application " << coupled_app_name << '\n');
     }
 
-  } // workset loop
+    // Evaluate shape functions at parametric point.
+    for (auto j = 0; j < parametric_dimension; ++j) {
+      pp_reduced(0, j) = parametric_point(0, 0, j);
+    }
+    basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
 
-  ALBANY_EXPECT(found == true);
+    CoupledPoint &
+    coupled_point = coupled_points_[ns_node];
 
-  // Evaluate shape functions at parametric point.
-  Kokkos::DynRankView<RealType, PHX::Device>
-  basis_values("basis", coupled_node_count, number_points);
+    coupled_point.local_nodes = local_nodes;
+    coupled_point.basis_values.resize(coupled_node_count);
 
-  // Another container for the parametric coordinates. Needed because above
-  // it is required that parametric_points has rank 3 for mapToReferenceFrame
-  // but here basis->getValues requires a rank 2 view :(
-  Kokkos::DynRankView<RealType, PHX::Device>
-  pp_reduced("par_point", number_points, parametric_dimension);
+    for (auto i = 0; i < coupled_node_count; ++i) {
+      coupled_point.basis_values[i] = basis_values(i, 0);
+    }
+
+  } // node set node loop
+
+  coupled_dimension_ = coupled_dimension;
+  this_mesh_version_ = this_mesh_version;
+  coupled_mesh_version_ = coupled_mesh_version;
+}
+
+//
+//
+//
+template<typename EvalT, typename Traits>
+template<typename T>
+void
+SchwarzBC_Base<EvalT, Traits>::
+computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
+{
+  auto const
+  coupled_app_index = getCoupledAppIndex();
+
+  Albany::Application const &
+  coupled_app = getApplication(coupled_app_index);
 
-  for (auto j = 0; j < parametric_dimension; ++j) {
-    pp_reduced(0, j) = parametric_point(0, 0, j);
+  Teuchos::RCP<Tpetra_Vector const>
+  coupled_solution = coupled_app.getX();
+
+  if (coupled_solution == Teuchos::null) {
+    x_val = 0.0;
+    y_val = 0.0;
+    z_val = 0.0;
+    return;
   }
-  basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
 
-  // Evaluate solution at parametric point using values of shape
-  // functions just computed.
+  updateCoupledPoints();
+
+  CoupledPoint const &
+  coupled_point = coupled_points_[ns_node];
+
+  Teuchos::ArrayRCP<ST const>
+  coupled_solution_view = coupled_solution->get1dView();
+
+  // Evaluate solution at the point using the values of the shape
+  // functions stored when it was located.
   minitensor::Vector<double>
-  value(coupled_dimension, minitensor::Filler::ZEROS);
+  value(coupled_dimension_, minitensor::Filler::ZEROS);
+
+  for (auto i = 0; i < coupled_point.local_nodes.size(); ++i) {
 
-  for (auto i = 0; i < coupled_node_count; ++i) {
-    value += basis_values(i, 0) * coupled_element_solution[i];
+    auto const
+    local_node_id = coupled_point.local_nodes[i];
+
+    for (auto j = 0; j < coupled_dimension_; ++j) {
+      value(j) += coupled_point.basis_values[i] *
+          coupled_solution_view[coupled_dimension_ * local_node_id + j];
+    }
   }
 
   x_val = value(0);
@@ -7,6 +7,7 @@
 #include <MiniTensor.h>
 #include <PHAL_Utilities.hpp>
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 #include "Teuchos_TestForException.hpp"
 #ifdef ALBANY_TIMER
 #include <chrono>
@@ -109,6 +110,7 @@ template<typename EvalT, typename Traits>
 void
 Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
   minitensor::Tensor<ScalarT> F(num_dims_), strain(num_dims_), gradu(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
 
@@ -7,6 +7,7 @@
 #include <MiniTensor.h>
 #include <MiniTensor_Mechanics.h>
 #include <Phalanx_DataLayout.hpp>
+#include <PHAL_EvaluatorProfile.hpp>
 #include <Sacado_ParameterRegistration.hpp>
 #include <Teuchos_TestForException.hpp>
 
@@ -209,6 +210,7 @@ void
 MechanicsResidual<EvalT, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int node = 0; node < num_nodes_; ++node)
       for (int dim = 0; dim < num_dims_; ++dim)
@@ -5,6 +5,7 @@
 //*****************************************************************//
 
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_TestForException.hpp"
 
@@ -40,7 +41,10 @@
 #include "TvergaardHutchinsonModel.hpp"
 #include "ViscoElasticModel.hpp"
 
+#include "../parallel_models/ParallelLinearElasticModel.hpp"
+#include "../parallel_models/ParallelMooneyRivlinModel.hpp"
 #include "../parallel_models/ParallelNeohookeanModel.hpp"
+#include "../parallel_models/ParallelStVenantKirchhoffModel.hpp"
 
 namespace LCM {
 
@@ -234,6 +238,7 @@ void
 ConstitutiveModelInterface<EvalT, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
   model_->computeState(workset, dep_fields_map_, eval_fields_map_);
   if (volume_average_pressure_) {
     model_->computeVolumeAverage(workset, dep_fields_map_, eval_fields_map_);
@@ -294,6 +299,8 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(
     model = rcp(new GursonHMRModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Mooney Rivlin") {
     model = rcp(new MooneyRivlinModel<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel Mooney Rivlin") {
+    model = rcp(new ParallelMooneyRivlinModel<EvalT, Traits>(p, dl));
   } else if (model_name == "RIHMR") {
     model = rcp(new RIHMRModel<EvalT, Traits>(p, dl));
   } else if (model_name == "J2Fiber") {
@@ -304,10 +311,14 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(
     model = rcp(new ElasticDamageModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Saint Venant Kirchhoff") {
     model = rcp(new StVenantKirchhoffModel<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel Saint Venant Kirchhoff") {
+    model = rcp(new ParallelStVenantKirchhoffModel<EvalT, Traits>(p, dl));
   } else if (model_name == "AAA") {
     model = rcp(new AAAModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Linear Elastic") {
     model = rcp(new LinearElasticModel<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel Linear Elastic") {
+    model = rcp(new ParallelLinearElasticModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Hyperelastic Damage") {
     model = rcp(new HyperelasticDamageModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Cap Explicit") {
@@ -12,8 +12,11 @@
 #include "core/CrystalPlasticity/Integrator.hpp"
 #include "../parallel_models/ParallelConstitutiveModel.hpp"
 #include "NOX_StatusTest_ModelEvaluatorFlag.h"
+#include "LocalSolutionCache.hpp"
 #include "../../utility/StaticAllocator.hpp"
 
+#include <memory>
+
 namespace LCM
 {
 
@@ -79,6 +82,9 @@ public:
        FieldMap<const ScalarT> & dep_fields,
        FieldMap<ScalarT> & eval_fields);
 
+  void
+  finish();
+
   ///
   /// Method to compute the state for a single cell and quadrature point
   //  (e.g. energy, stress, tangent)
@@ -219,6 +225,10 @@ private:
   bool
   write_data_file_{false};
 
+  /// Converged slips of the last global iteration and local iteration counts
+  std::unique_ptr<LocalSolutionCache>
+  local_cache_;
+
   ///
   /// Dependent MDFields
   ///
@@ -10,6 +10,7 @@
 #include <Tsqr_Matrix.hpp>
 //*/
 #include "Phalanx_DataLayout.hpp"
+#include "Phalanx_TypeStrings.hpp"
 #include "Albany_Utils.hpp"
 
 #include <MiniLinearSolver.h>
@@ -129,6 +130,11 @@ CrystalPlasticityKernel(
 
   write_data_file_ = p->get<bool>("Write Data File", false);
 
+  local_cache_.reset(new LocalSolutionCache(
+      "Crystal Plasticity " + PHX::typeAsString<EvalT>(),
+      num_slip_,
+      p->get<bool>("Warm Start Local Solve", false)));
+
   if (verbosity_ >= CP::Verbosity::HIGH) {
     std::cout << ">>> in cp constructor\n";
     std::cout << ">>> parameter list:\n" << *p << std::endl;
@@ -487,12 +493,22 @@ void CrystalPlasticityKernel<EvalT, Traits>::init(
 
   dt_ = SSV::eval(delta_time_(0));
 
+  local_cache_->setWorkset(
+      workset.wsIndex, workset.numCells, num_pts_, workset.current_time);
+
   // Resest status and status message for model failure test
   //nox_status_test_->status_message_ = "";
   //nox_status_test_->status_ = NOX::StatusTest::Unevaluated;
 }
 
 
+template<typename EvalT, typename Traits>
+void CrystalPlasticityKernel<EvalT, Traits>::finish()
+{
+  local_cache_->flushStatistics();
+}
+
+
 template<typename EvalT, typename Traits>
 KOKKOS_INLINE_FUNCTION void
 CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
@@ -864,6 +880,20 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
     }
   }
 
+  //
+  // Within a load step the slips of the last global iteration are a
+  // better guess for the implicit integration than the predictor
+  //
+  RealType
+  slip_guess[CP::MAX_SLIP];
+
+  if (integration_scheme_ == CP::IntegrationScheme::IMPLICIT &&
+      local_cache_->get(cell, pt, slip_guess) == true) {
+    for (int s(0); s < num_slip_; ++s) {
+      slip_np1[s] = slip_guess[s];
+    }
+  }
+
   if(verbosity_ >= CP::Verbosity::HIGH)
   {
     for (int s(0); s < num_slip_; ++s) {
@@ -938,11 +968,22 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
   // Check to make sure there is only one status test
   ALBANY_ASSERT(integrator->getStatus() == nox_status_test_->status_);
 
+  if (integration_scheme_ == CP::IntegrationScheme::IMPLICIT) {
+    local_cache_->addSolve(integrator->getNumIters());
+  }
+
   // Exit early if update state is not successful
   if(nox_status_test_->status_ == NOX::StatusTest::Failed) {
     return;
   }
 
+  if (integration_scheme_ == CP::IntegrationScheme::IMPLICIT) {
+    for (int s(0); s < num_slip_; ++s) {
+      slip_guess[s] = SSV::eval(state_internal.slip_np1_[s]);
+    }
+    local_cache_->put(cell, pt, slip_guess);
+  }
+
   finalize(
     state_mechanical,
     state_internal,
@@ -8,6 +8,9 @@
 #define LCM_J2MiniSolver_hpp
 
 #include "../parallel_models/ParallelConstitutiveModel.hpp"
+#include "LocalSolutionCache.hpp"
+
+#include <memory>
 
 namespace LCM {
 
@@ -51,6 +54,7 @@ struct J2MiniKernel : public ParallelKernel<EvalT, Traits>
   using BaseKernel::density_;
   using BaseKernel::temperature_;
 
+  using BaseKernel::bindOptionalFields;
   using BaseKernel::setDependentField;
   using BaseKernel::setEvaluatedField;
   using BaseKernel::addStateVariable;
@@ -82,12 +86,19 @@ struct J2MiniKernel : public ParallelKernel<EvalT, Traits>
   RealType sat_mod;
   RealType sat_exp;
 
+  // Converged plastic multipliers of the last global iteration and
+  // local iteration counts
+  std::unique_ptr<LocalSolutionCache> local_cache;
+
   void
   init(
       Workset&                 workset,
       FieldMap<ScalarT const>& dep_fields,
       FieldMap<ScalarT>&       eval_fields);
 
+  void
+  finish();
+
   KOKKOS_INLINE_FUNCTION
   void
   operator()(int cell, int pt) const;
@@ -6,6 +6,7 @@
 #include "Albany_Utils.hpp"
 #include "J2MiniSolver.hpp"
 #include "MiniNonlinearSolver.h"
+#include "Phalanx_TypeStrings.hpp"
 
 namespace LCM {
 
@@ -15,7 +16,11 @@ J2MiniKernel<EvalT, Traits>::J2MiniKernel(
     Teuchos::ParameterList*              p,
     Teuchos::RCP<Albany::Layouts> const& dl)
     : BaseKernel(model), sat_mod(p->get<RealType>("Saturation Modulus", 0.0)),
-      sat_exp(p->get<RealType>("Saturation Exponent", 0.0))
+      sat_exp(p->get<RealType>("Saturation Exponent", 0.0)),
+      local_cache(new LocalSolutionCache(
+          "J2 " + PHX::typeAsString<EvalT>(),
+          1,
+          p->get<bool>("Warm Start Local Solve", false)))
 {
   // retrieve appropriate field name strings
   std::string const cauchy_string       = field_name_map_["Cauchy_Stress"];
@@ -128,9 +133,22 @@ J2MiniKernel<EvalT, Traits>::init(
     source = *eval_fields[source_string];
   }
 
+  // temperature is bound to the model after the kernel was constructed
+  bindOptionalFields();
+
   // get State Variables
   Fpold   = (*workset.stateArrayPtr)[Fp_string + "_old"];
   eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+
+  local_cache->setWorkset(
+      workset.wsIndex, workset.numCells, num_pts_, workset.current_time);
+}
+
+template<typename EvalT, typename Traits>
+void
+J2MiniKernel<EvalT, Traits>::finish()
+{
+  local_cache->flushStatistics();
 }
 
 //
@@ -286,9 +304,21 @@ J2MiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
     x(0) = 0.0;
 
+    // Start from the plastic multiplier of the last global iteration
+    RealType x0{0.0};
+
+    if (local_cache->get(cell, pt, &x0) == true) x(0) = x0;
+
     LCM::MiniSolver<MIN, STEP, NLS, EvalT, nls_dim> mini_solver(
         minimizer, step, j2nls, x);
 
+    local_cache->addSolve(minimizer.num_iter);
+
+    if (minimizer.converged == true) {
+      x0 = Sacado::ScalarValue<ScalarT>::eval(x(0));
+      local_cache->put(cell, pt, &x0);
+    }
+
     ScalarT const alpha = eqpsold(cell, pt) + sq23 * x(0);
     ScalarT const H     = K * alpha + sat_mod * (1.0 - exp(-sat_exp * alpha));
     ScalarT const dgam  = x(0);
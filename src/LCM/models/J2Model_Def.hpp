@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Teuchos_TestForException.hpp"
 
+#include "Albany_FrozenElements.hpp"
 #include "LocalNonlinearSolver.hpp"
 
 namespace LCM {
@@ -157,6 +158,8 @@ J2Model<EvalT, Traits>::computeState(
       Cpinv(num_dims_);
 
   for (int cell(0); cell < workset.numCells; ++cell) {
+    // No plastic flow at any point: the cell responds elastically
+    bool elastic = true;
     for (int pt(0); pt < num_pts_; ++pt) {
       kappa = elastic_modulus(cell, pt) /
               (3. * (1. - 2. * poissons_ratio(cell, pt)));
@@ -190,6 +193,7 @@ J2Model<EvalT, Traits>::computeState(
 
       if (f > 1E-12) {
         // return mapping algorithm
+        elastic = false;
 
         bool    converged = false;
         ScalarT g         = f;
@@ -300,6 +304,10 @@ J2Model<EvalT, Traits>::computeState(
         }
       }
     }
+
+    if (elastic == true && Teuchos::nonnull(workset.frozen_elements)) {
+      workset.frozen_elements->flagUnchanged(workset.wsIndex, cell);
+    }
   }
 
   if (have_temperature_) {
@@ -164,28 +164,29 @@ CP::updateSlip(
     minitensor::Vector<ArgT, NumSlipT> & slip_np1,
     bool & failed)
 {
-  for (unsigned int ss_index(0); ss_index < slip_systems.size(); ++ ss_index)
+  minitensor::Vector<ArgT, NumSlipT>
+  rate_slip(shear.get_dimension(), minitensor::Filler::ZEROS);
+
+  // One batch per slip family, all systems of a family share a flow rule.
+  for (unsigned int sf_index(0); sf_index < slip_families.size(); ++sf_index)
   {
     auto const &
-    slip_family = slip_families[slip_systems.at(ss_index).slip_family_index_];
-
-    auto
-    type_flow_rule = slip_family.getFlowRuleType();
-
-    FlowRuleFactory
-    flow_rule_factory;
-
-    auto
-    pflow = flow_rule_factory.template createFlowRule<ArgT>(type_flow_rule);
+    slip_family = slip_families[sf_index];
 
-    ArgT
-    rate_slip = pflow->computeRateSlip(
-        slip_family.pflow_parameters_,
-        shear[ss_index],
-        slip_resistance[ss_index],
+    CP::computeRateSlipBatch(
+        slip_family.getFlowRuleType(),
+        *(slip_family.pflow_parameters_),
+        slip_family.slip_system_indices_,
+        slip_family.num_slip_sys_,
+        shear,
+        slip_resistance,
+        rate_slip,
         failed);
+  }
 
-    slip_np1[ss_index] = slip_n[ss_index] + dt * rate_slip;
+  for (unsigned int ss_index(0); ss_index < slip_systems.size(); ++ ss_index)
+  {
+    slip_np1[ss_index] = slip_n[ss_index] + dt * rate_slip[ss_index];
   }
 
   return;
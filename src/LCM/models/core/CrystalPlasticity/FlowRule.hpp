@@ -257,6 +257,14 @@ struct PowerLawFlowRule final : public FlowRuleBase<ArgT>
     ArgT const & slip_resistance,
     bool & failed);
 
+  static
+  ArgT
+  rateSlip(
+    FlowParameterBase const & flow_parameters,
+    ArgT const & shear,
+    ArgT const & slip_resistance,
+    bool & failed);
+
   virtual
   ~PowerLawFlowRule() {}
 };
@@ -278,6 +286,14 @@ struct ThermalActivationFlowRule final : public FlowRuleBase<ArgT>
     ArgT const & slip_resistance,
     bool & failed);
 
+  static
+  ArgT
+  rateSlip(
+    FlowParameterBase const & flow_parameters,
+    ArgT const & shear,
+    ArgT const & slip_resistance,
+    bool & failed);
+
   virtual
   ~ThermalActivationFlowRule() {}
 };
@@ -299,6 +315,14 @@ struct PowerLawDragFlowRule final : public FlowRuleBase<ArgT>
     ArgT const & slip_resistance,
     bool & failed);
 
+  static
+  ArgT
+  rateSlip(
+    FlowParameterBase const & flow_parameters,
+    ArgT const & shear,
+    ArgT const & slip_resistance,
+    bool & failed);
+
   virtual
   ~PowerLawDragFlowRule() {}
 };
@@ -320,12 +344,52 @@ struct NoFlowRule final : public FlowRuleBase<ArgT>
     ArgT const & slip_resistance,
     bool & failed);
 
+  static
+  ArgT
+  rateSlip(
+    FlowParameterBase const & flow_parameters,
+    ArgT const & shear,
+    ArgT const & slip_resistance,
+    bool & failed);
+
   virtual
   ~NoFlowRule() {}
 };
 
 
 
+/**
+ *  Slip rates of the slip systems slip_system_indices(0..num_slip_sys-1),
+ *  which share the flow rule FlowRuleT. The flow rule is resolved at compile
+ *  time, so there is no virtual call or factory per slip system.
+ */
+template<typename FlowRuleT, minitensor::Index NumSlipT, typename ArgT>
+void
+computeRateSlipBatch(
+  FlowParameterBase const & flow_parameters,
+  minitensor::Vector<minitensor::Index, NumSlipT> const & slip_system_indices,
+  minitensor::Index const num_slip_sys,
+  minitensor::Vector<ArgT, NumSlipT> const & shear,
+  minitensor::Vector<ArgT, NumSlipT> const & slip_resistance,
+  minitensor::Vector<ArgT, NumSlipT> & rate_slip,
+  bool & failed);
+
+
+/**
+ *  Same as above, with the flow rule chosen at run time once per batch.
+ */
+template<minitensor::Index NumSlipT, typename ArgT>
+void
+computeRateSlipBatch(
+  FlowRuleType type_flow_rule,
+  FlowParameterBase const & flow_parameters,
+  minitensor::Vector<minitensor::Index, NumSlipT> const & slip_system_indices,
+  minitensor::Index const num_slip_sys,
+  minitensor::Vector<ArgT, NumSlipT> const & shear,
+  minitensor::Vector<ArgT, NumSlipT> const & slip_resistance,
+  minitensor::Vector<ArgT, NumSlipT> & rate_slip,
+  bool & failed);
+
 }
 
 #include "FlowRule_Def.hpp"
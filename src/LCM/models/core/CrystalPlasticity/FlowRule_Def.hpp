@@ -86,21 +86,33 @@ computeRateSlip(
   ArgT const & shear,
   ArgT const & slip_resistance,
   bool & failed)
+{
+  return rateSlip(*pflow_parameters, shear, slip_resistance, failed);
+}
+
+template<typename ArgT>
+ArgT
+CP::PowerLawFlowRule<ArgT>::
+rateSlip(
+  CP::FlowParameterBase const & flow_parameters,
+  ArgT const & shear,
+  ArgT const & slip_resistance,
+  bool & failed)
 {
   using Params = PowerLawFlowParameters;
 
   // Material properties
   RealType const
-  m = pflow_parameters->getParameter(Params::EXPONENT_RATE);
+  m = flow_parameters.flow_params_(Params::EXPONENT_RATE);
 
   RealType const
-  g0 = pflow_parameters->getParameter(Params::RATE_SLIP_REFERENCE);
+  g0 = flow_parameters.flow_params_(Params::RATE_SLIP_REFERENCE);
 
   RealType const
-  min_tol = pflow_parameters->min_tol_;
+  min_tol = flow_parameters.min_tol_;
 
   RealType const
-  max_tol = pflow_parameters->max_tol_;
+  max_tol = flow_parameters.max_tol_;
 
   ArgT const
   ratio_stress = shear / slip_resistance;
@@ -138,6 +150,18 @@ computeRateSlip(
   ArgT const & shear,
   ArgT const & slip_resistance,
   bool & failed)
+{
+  return rateSlip(*pflow_parameters, shear, slip_resistance, failed);
+}
+
+template<typename ArgT>
+ArgT
+CP::ThermalActivationFlowRule<ArgT>::
+rateSlip(
+  CP::FlowParameterBase const & flow_parameters,
+  ArgT const & shear,
+  ArgT const & slip_resistance,
+  bool & failed)
 {
   using Params = ThermalActivationFlowParameters;
 
@@ -145,22 +169,22 @@ computeRateSlip(
   // Material properties
   //
   RealType const
-  g0 = pflow_parameters->getParameter(Params::RATE_SLIP_REFERENCE);
+  g0 = flow_parameters.flow_params_(Params::RATE_SLIP_REFERENCE);
 
   RealType const
-  F0 = pflow_parameters->getParameter(Params::ENERGY_ACTIVATION);
+  F0 = flow_parameters.flow_params_(Params::ENERGY_ACTIVATION);
 
   RealType const
-  s_t = pflow_parameters->getParameter(Params::RESISTANCE_THERMAL);
+  s_t = flow_parameters.flow_params_(Params::RESISTANCE_THERMAL);
 
   RealType const
-  p = pflow_parameters->getParameter(Params::EXPONENT_P);
+  p = flow_parameters.flow_params_(Params::EXPONENT_P);
 
   RealType const
-  q = pflow_parameters->getParameter(Params::EXPONENT_Q);
+  q = flow_parameters.flow_params_(Params::EXPONENT_Q);
 
   RealType const
-  min_tol = pflow_parameters->min_tol_;
+  min_tol = flow_parameters.min_tol_;
 
   ArgT const
   ratio_stress = std::max(0.0, (std::fabs(shear) - slip_resistance) / s_t);
@@ -192,24 +216,36 @@ computeRateSlip(
   ArgT const & shear,
   ArgT const & slip_resistance,
   bool & failed)
+{
+  return rateSlip(*pflow_parameters, shear, slip_resistance, failed);
+}
+
+template<typename ArgT>
+ArgT
+CP::PowerLawDragFlowRule<ArgT>::
+rateSlip(
+  CP::FlowParameterBase const & flow_parameters,
+  ArgT const & shear,
+  ArgT const & slip_resistance,
+  bool & failed)
 {
   using Params = PowerLawDragFlowParameters;
 
   // Material properties
   RealType const
-  m = pflow_parameters->getParameter(Params::EXPONENT_RATE);
+  m = flow_parameters.flow_params_(Params::EXPONENT_RATE);
 
   RealType const
-  g0 = pflow_parameters->getParameter(Params::RATE_SLIP_REFERENCE);
+  g0 = flow_parameters.flow_params_(Params::RATE_SLIP_REFERENCE);
 
   RealType const
-  coefficient_drag = pflow_parameters->getParameter(Params::COEFFICIENT_DRAG);
+  coefficient_drag = flow_parameters.flow_params_(Params::COEFFICIENT_DRAG);
 
   RealType const
-  min_tol = pflow_parameters->min_tol_;
+  min_tol = flow_parameters.min_tol_;
 
   RealType const
-  max_tol = pflow_parameters->max_tol_;
+  max_tol = flow_parameters.max_tol_;
 
   ArgT const
   ratio_stress = shear / slip_resistance;
@@ -288,6 +324,96 @@ computeRateSlip(
   ArgT const & slip_resistance,
   bool & failed)
 {
-  return 0.;
+  return rateSlip(*pflow_parameters, shear, slip_resistance, failed);
+}
+
+template<typename ArgT>
+ArgT
+CP::NoFlowRule<ArgT>::
+rateSlip(
+  CP::FlowParameterBase const & flow_parameters,
+  ArgT const & shear,
+  ArgT const & slip_resistance,
+  bool & failed)
+{
+  return 0.0 * shear;
 }
 
+
+
+//
+// Slip rates of a set of slip systems with the same flow rule
+//
+template<typename FlowRuleT, minitensor::Index NumSlipT, typename ArgT>
+void
+CP::computeRateSlipBatch(
+  CP::FlowParameterBase const & flow_parameters,
+  minitensor::Vector<minitensor::Index, NumSlipT> const & slip_system_indices,
+  minitensor::Index const num_slip_sys,
+  minitensor::Vector<ArgT, NumSlipT> const & shear,
+  minitensor::Vector<ArgT, NumSlipT> const & slip_resistance,
+  minitensor::Vector<ArgT, NumSlipT> & rate_slip,
+  bool & failed)
+{
+  for (minitensor::Index ss_index(0); ss_index < num_slip_sys; ++ss_index)
+  {
+    minitensor::Index const
+    ss_index_global = slip_system_indices(ss_index);
+
+    rate_slip(ss_index_global) = FlowRuleT::rateSlip(
+        flow_parameters,
+        shear(ss_index_global),
+        slip_resistance(ss_index_global),
+        failed);
+  }
+}
+
+
+//
+// Dispatch to the batched flow rule of the given type
+//
+template<minitensor::Index NumSlipT, typename ArgT>
+void
+CP::computeRateSlipBatch(
+  CP::FlowRuleType type_flow_rule,
+  CP::FlowParameterBase const & flow_parameters,
+  minitensor::Vector<minitensor::Index, NumSlipT> const & slip_system_indices,
+  minitensor::Index const num_slip_sys,
+  minitensor::Vector<ArgT, NumSlipT> const & shear,
+  minitensor::Vector<ArgT, NumSlipT> const & slip_resistance,
+  minitensor::Vector<ArgT, NumSlipT> & rate_slip,
+  bool & failed)
+{
+  switch (type_flow_rule) {
+
+    default:
+      std::cerr << __PRETTY_FUNCTION__ << '\n';
+      std::cerr << "ERROR: Unknown flow rule\n";
+      exit(1);
+      break;
+
+    case FlowRuleType::POWER_LAW:
+      computeRateSlipBatch<PowerLawFlowRule<ArgT>>(flow_parameters,
+          slip_system_indices, num_slip_sys, shear, slip_resistance,
+          rate_slip, failed);
+      break;
+
+    case FlowRuleType::POWER_LAW_DRAG:
+      computeRateSlipBatch<PowerLawDragFlowRule<ArgT>>(flow_parameters,
+          slip_system_indices, num_slip_sys, shear, slip_resistance,
+          rate_slip, failed);
+      break;
+
+    case FlowRuleType::THERMAL_ACTIVATION:
+      computeRateSlipBatch<ThermalActivationFlowRule<ArgT>>(flow_parameters,
+          slip_system_indices, num_slip_sys, shear, slip_resistance,
+          rate_slip, failed);
+      break;
+
+    case FlowRuleType::UNDEFINED:
+      computeRateSlipBatch<NoFlowRule<ArgT>>(flow_parameters,
+          slip_system_indices, num_slip_sys, shear, slip_resistance,
+          rate_slip, failed);
+      break;
+  }
+}
@@ -30,6 +30,15 @@ struct ParallelKernel
   using ScalarField = PHX::MDField<ScalarT>;
   using ConstScalarField = PHX::MDField<const ScalarT>;
 
+  ///
+  /// Called after the kernel has run on all points of a workset.
+  /// Kernels that gather per-workset data hide it.
+  ///
+  void
+  finish()
+  {
+  }
+
 protected:
 
   ParallelKernel(ConstitutiveModel<EvalT, Traits> &model)
@@ -79,6 +88,24 @@ protected:
     model_.setEvaluatedField(field_name, field);
   }
 
+  ///
+  /// Copy the optional fields from the model. The interface binds them to
+  /// the model in postRegistrationSetup, after the kernel is constructed,
+  /// so kernels that use them call this from init().
+  ///
+  void
+  bindOptionalFields()
+  {
+    coord_vec_ = model_.coord_vec_;
+    temperature_ = model_.temperature_;
+    total_concentration_ = model_.total_concentration_;
+    total_bubble_density_ = model_.total_bubble_density_;
+    bubble_volume_fraction_ = model_.bubble_volume_fraction_;
+    damage_ = model_.damage_;
+    weights_ = model_.weights_;
+    j_ = model_.j_;
+  }
+
   void addStateVariable(std::string const & name,
                         Teuchos::RCP<PHX::DataLayout> layout,
                         std::string const & init_type,
@@ -71,6 +71,8 @@ computeState(
     });
 
   Kokkos::fence();
+
+  kernel_->finish();
 }
 
 template<typename EvalT, typename Traits>
@@ -0,0 +1,80 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelLinearElasticModel_hpp)
+#define LCM_ParallelLinearElasticModel_hpp
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Albany_Layouts.hpp"
+#include "ParallelConstitutiveModel.hpp"
+
+namespace LCM
+{
+template<typename EvalT, typename Traits>
+struct LinearElasticKernel : public ParallelKernel<EvalT, Traits>
+{
+  ///
+  /// Constructor
+  ///
+  LinearElasticKernel(ConstitutiveModel<EvalT, Traits> &model,
+      Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  LinearElasticKernel(const LinearElasticKernel&) = delete;
+  LinearElasticKernel& operator=(const LinearElasticKernel&) = delete;
+
+  using ScalarT = typename EvalT::ScalarT;
+  using MeshScalarT = typename EvalT::MeshScalarT;
+  using ScalarField = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<const ScalarT>;
+  using BaseKernel = ParallelKernel<EvalT, Traits>;
+  using Workset = typename BaseKernel::Workset;
+
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
+
+  // optional temperature support
+  using BaseKernel::have_temperature_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::temperature_;
+
+  using BaseKernel::bindOptionalFields;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  using BaseKernel::nox_status_test_;
+
+  // Dependent MDFields
+  ConstScalarField strain;
+  ConstScalarField poissons_ratio;
+  ConstScalarField elastic_modulus;
+
+  // Evaluated MDFields
+  ScalarField stress;
+
+  void init(Workset &workset,
+       FieldMap<const ScalarT> &dep_fields,
+       FieldMap<ScalarT> &eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (int cell, int pt) const;
+};
+
+template<typename EvalT, typename Traits>
+class ParallelLinearElasticModel : public LCM::ParallelConstitutiveModel<EvalT, Traits, LinearElasticKernel<EvalT, Traits>> {
+public:
+  ParallelLinearElasticModel(Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+};
+}
+
+#endif
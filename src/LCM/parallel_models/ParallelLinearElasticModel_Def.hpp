@@ -0,0 +1,97 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelLinearElasticModel_Def_hpp)
+#define LCM_ParallelLinearElasticModel_Def_hpp
+
+#include <MiniTensor.h>
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace LCM
+{
+
+//----------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+LinearElasticKernel<EvalT, Traits>::
+LinearElasticKernel(ConstitutiveModel<EvalT, Traits> &model,
+                    Teuchos::ParameterList* p,
+                    const Teuchos::RCP<Albany::Layouts>& dl)
+  : BaseKernel(model)
+{
+  std::string cauchy = field_name_map_["Cauchy_Stress"];
+
+  // define the dependent fields
+  setDependentField("Strain", dl->qp_tensor);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+
+  // define the evaluated fields
+  setEvaluatedField(cauchy, dl->qp_tensor);
+
+  // define the state variables
+  addStateVariable(cauchy, dl->qp_tensor, "scalar", 0.0, false, true);
+}
+
+
+template<typename EvalT, typename Traits>
+void
+LinearElasticKernel<EvalT, Traits>::
+init(Workset &workset,
+     FieldMap<const ScalarT> &dep_fields,
+     FieldMap<ScalarT> &eval_fields)
+{
+  std::string cauchy = field_name_map_["Cauchy_Stress"];
+
+  // extract dependent MDFields
+  strain = *dep_fields["Strain"];
+  poissons_ratio = *dep_fields["Poissons Ratio"];
+  elastic_modulus = *dep_fields["Elastic Modulus"];
+  // extract evaluated MDFields
+  stress = *eval_fields[cauchy];
+
+  // temperature is bound to the model after the kernel was constructed
+  bindOptionalFields();
+}
+
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+LinearElasticKernel<EvalT, Traits>::
+operator()(int cell, int pt) const
+{
+  constexpr minitensor::Index MAX_DIM{3};
+
+  using Tensor = minitensor::Tensor<ScalarT, MAX_DIM>;
+
+  Tensor eps(num_dims_), sigma(num_dims_);
+  Tensor const I(minitensor::eye<ScalarT, MAX_DIM>(num_dims_));
+
+  ScalarT const E = elastic_modulus(cell, pt);
+  ScalarT const nu = poissons_ratio(cell, pt);
+  ScalarT const lambda = (E * nu) / ((1 + nu) * (1 - 2 * nu));
+  ScalarT const mu = E / (2 * (1 + nu));
+
+  eps.fill(strain, cell, pt, 0, 0);
+
+  sigma = 2.0 * mu * eps + lambda * minitensor::trace(eps) * I;
+
+  // adjustment for thermal expansion
+  if (have_temperature_) {
+    ScalarT const three_kappa = E / (1.0 - 2.0 * nu);
+    sigma -= three_kappa * expansion_coeff_
+      * (temperature_(cell, pt) - ref_temperature_) * I;
+  }
+
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      stress(cell, pt, i, j) = sigma(i, j);
+    }
+  }
+}
+
+}
+
+#endif
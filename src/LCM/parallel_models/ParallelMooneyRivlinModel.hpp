@@ -0,0 +1,77 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelMooneyRivlinModel_hpp)
+#define LCM_ParallelMooneyRivlinModel_hpp
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Albany_Layouts.hpp"
+#include "ParallelConstitutiveModel.hpp"
+
+namespace LCM
+{
+template<typename EvalT, typename Traits>
+struct MooneyRivlinKernel : public ParallelKernel<EvalT, Traits>
+{
+  ///
+  /// Constructor
+  ///
+  MooneyRivlinKernel(ConstitutiveModel<EvalT, Traits> &model,
+      Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  MooneyRivlinKernel(const MooneyRivlinKernel&) = delete;
+  MooneyRivlinKernel& operator=(const MooneyRivlinKernel&) = delete;
+
+  using ScalarT = typename EvalT::ScalarT;
+  using MeshScalarT = typename EvalT::MeshScalarT;
+  using ScalarField = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<const ScalarT>;
+  using BaseKernel = ParallelKernel<EvalT, Traits>;
+  using Workset = typename BaseKernel::Workset;
+
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
+
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  using BaseKernel::nox_status_test_;
+
+  // Dependent MDFields
+  ConstScalarField def_grad;
+  ConstScalarField J;
+
+  // Evaluated MDFields
+  ScalarField stress;
+
+  // Material constants
+  RealType c1;
+  RealType c2;
+  RealType c;
+
+  void init(Workset &workset,
+       FieldMap<const ScalarT> &dep_fields,
+       FieldMap<ScalarT> &eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (int cell, int pt) const;
+};
+
+template<typename EvalT, typename Traits>
+class ParallelMooneyRivlinModel : public LCM::ParallelConstitutiveModel<EvalT, Traits, MooneyRivlinKernel<EvalT, Traits>> {
+public:
+  ParallelMooneyRivlinModel(Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+};
+}
+
+#endif
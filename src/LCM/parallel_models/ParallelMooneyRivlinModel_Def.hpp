@@ -0,0 +1,92 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelMooneyRivlinModel_Def_hpp)
+#define LCM_ParallelMooneyRivlinModel_Def_hpp
+
+#include <MiniTensor.h>
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace LCM
+{
+
+//----------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+MooneyRivlinKernel<EvalT, Traits>::
+MooneyRivlinKernel(ConstitutiveModel<EvalT, Traits> &model,
+                   Teuchos::ParameterList* p,
+                   const Teuchos::RCP<Albany::Layouts>& dl)
+  : BaseKernel(model),
+    c1(p->get<RealType>("c1", 0.0)),
+    c2(p->get<RealType>("c2", 0.0)),
+    c(p->get<RealType>("c", 0.0))
+{
+  std::string F_string = field_name_map_["F"];
+  std::string J_string = field_name_map_["J"];
+  std::string cauchy = field_name_map_["Cauchy_Stress"];
+
+  // define the dependent fields
+  setDependentField(F_string, dl->qp_tensor);
+  setDependentField(J_string, dl->qp_scalar);
+
+  // define the evaluated fields
+  setEvaluatedField(cauchy, dl->qp_tensor);
+
+  // define the state variables
+  addStateVariable(cauchy, dl->qp_tensor, "scalar", 0.0, false, true);
+}
+
+
+template<typename EvalT, typename Traits>
+void
+MooneyRivlinKernel<EvalT, Traits>::
+init(Workset &workset,
+     FieldMap<const ScalarT> &dep_fields,
+     FieldMap<ScalarT> &eval_fields)
+{
+  std::string F_string = field_name_map_["F"];
+  std::string J_string = field_name_map_["J"];
+  std::string cauchy = field_name_map_["Cauchy_Stress"];
+
+  // extract dependent MDFields
+  def_grad = *dep_fields[F_string];
+  J = *dep_fields[J_string];
+  // extract evaluated MDFields
+  stress = *eval_fields[cauchy];
+}
+
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+MooneyRivlinKernel<EvalT, Traits>::
+operator()(int cell, int pt) const
+{
+  constexpr minitensor::Index MAX_DIM{3};
+
+  using Tensor = minitensor::Tensor<ScalarT, MAX_DIM>;
+
+  Tensor F(num_dims_), C(num_dims_), S(num_dims_), sigma(num_dims_);
+  Tensor const I(minitensor::eye<ScalarT, MAX_DIM>(num_dims_));
+
+  RealType const d = 2.0 * (c1 + 2 * c2);
+  ScalarT const J1 = J(cell, pt);
+
+  F.fill(def_grad, cell, pt, 0, 0);
+  C = minitensor::transpose(F) * F;
+  S = 2.0 * (c1 + c2 * minitensor::I1(C)) * I - 2.0 * c2 * C
+      + (2.0 * c * J1 * (J1 - 1.0) - d) * minitensor::inverse(C);
+  sigma = (1. / J1) * F * S * minitensor::transpose(F);
+
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      stress(cell, pt, i, j) = sigma(i, j);
+    }
+  }
+}
+
+}
+
+#endif
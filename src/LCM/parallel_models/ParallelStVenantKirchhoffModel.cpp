@@ -0,0 +1,20 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "ParallelStVenantKirchhoffModel.hpp"
+#include "ParallelStVenantKirchhoffModel_Def.hpp"
+#include "../parallel_models/ParallelConstitutiveModel_Def.hpp"
+
+template<typename EvalT, typename Traits>
+LCM::ParallelStVenantKirchhoffModel<EvalT,Traits>::ParallelStVenantKirchhoffModel(Teuchos::ParameterList* p,
+    const Teuchos::RCP<Albany::Layouts>& dl):
+  LCM::ParallelConstitutiveModel<EvalT, Traits, StVenantKirchhoffKernel<EvalT, Traits>>(p, dl)
+{}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::StVenantKirchhoffKernel)
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::ParallelStVenantKirchhoffModel)
@@ -0,0 +1,96 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelStVenantKirchhoffModel_Def_hpp)
+#define LCM_ParallelStVenantKirchhoffModel_Def_hpp
+
+#include <MiniTensor.h>
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace LCM
+{
+
+//----------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+StVenantKirchhoffKernel<EvalT, Traits>::
+StVenantKirchhoffKernel(ConstitutiveModel<EvalT, Traits> &model,
+                        Teuchos::ParameterList* p,
+                        const Teuchos::RCP<Albany::Layouts>& dl)
+  : BaseKernel(model)
+{
+  std::string F_string = field_name_map_["F"];
+  std::string J_string = field_name_map_["J"];
+  std::string cauchy = field_name_map_["Cauchy_Stress"];
+
+  // define the dependent fields
+  setDependentField(F_string, dl->qp_tensor);
+  setDependentField(J_string, dl->qp_scalar);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+
+  // define the evaluated fields
+  setEvaluatedField(cauchy, dl->qp_tensor);
+
+  // define the state variables
+  addStateVariable(cauchy, dl->qp_tensor, "scalar", 0.0, false, true);
+}
+
+
+template<typename EvalT, typename Traits>
+void
+StVenantKirchhoffKernel<EvalT, Traits>::
+init(Workset &workset,
+     FieldMap<const ScalarT> &dep_fields,
+     FieldMap<ScalarT> &eval_fields)
+{
+  std::string F_string = field_name_map_["F"];
+  std::string J_string = field_name_map_["J"];
+  std::string cauchy = field_name_map_["Cauchy_Stress"];
+
+  // extract dependent MDFields
+  def_grad = *dep_fields[F_string];
+  J = *dep_fields[J_string];
+  poissons_ratio = *dep_fields["Poissons Ratio"];
+  elastic_modulus = *dep_fields["Elastic Modulus"];
+  // extract evaluated MDFields
+  stress = *eval_fields[cauchy];
+}
+
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+StVenantKirchhoffKernel<EvalT, Traits>::
+operator()(int cell, int pt) const
+{
+  constexpr minitensor::Index MAX_DIM{3};
+
+  using Tensor = minitensor::Tensor<ScalarT, MAX_DIM>;
+
+  Tensor F(num_dims_), C(num_dims_), E(num_dims_), S(num_dims_);
+  Tensor sigma(num_dims_);
+  Tensor const I(minitensor::eye<ScalarT, MAX_DIM>(num_dims_));
+
+  ScalarT const nu = poissons_ratio(cell, pt);
+  ScalarT const lambda =
+      (elastic_modulus(cell, pt) * nu) / (1. + nu) / (1 - 2 * nu);
+  ScalarT const mu = elastic_modulus(cell, pt) / (2. * (1. + nu));
+
+  F.fill(def_grad, cell, pt, 0, 0);
+  C = F * minitensor::transpose(F);
+  E = 0.5 * (C - I);
+  S = lambda * minitensor::trace(E) * I + 2.0 * mu * E;
+  sigma = (1.0 / minitensor::det(F)) * F * S * minitensor::transpose(F);
+
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      stress(cell, pt, i, j) = sigma(i, j);
+    }
+  }
+}
+
+}
+
+#endif
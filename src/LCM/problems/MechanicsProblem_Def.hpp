@@ -212,7 +212,8 @@ MechanicsProblem::constructEvaluators(
   
   // set flag for small strain option
   bool
-  small_strain{material_model_name == "Linear Elastic"};
+  small_strain{material_model_name == "Linear Elastic" ||
+               material_model_name == "Parallel Linear Elastic"};
 
   if (material_db_->isElementBlockParam(eb_name, "Strain Flag")) {
     small_strain = true;
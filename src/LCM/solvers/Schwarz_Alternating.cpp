@@ -3,6 +3,7 @@
 //    This Software is released under the BSD license detailed     //
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
+#include "Albany_ConcurrentSolves.hpp"
 #include "Albany_ModelFactory.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_STKDiscretization.hpp"
@@ -11,6 +12,9 @@
 #include "Piro_TempusSolver.hpp"
 #include "Schwarz_Alternating.hpp"
 
+#include <algorithm>
+#include <exception>
+
 //#define DEBUG
 
 namespace LCM {
@@ -50,6 +54,14 @@ SchwarzAlternating(
   increase_factor_ = alt_system_params.get<ST>("Increase Factor", 1.0);
   output_interval_ = alt_system_params.get<int>("Exodus Write Interval", 1);
 
+  std::string const
+  variant = alt_system_params.get<std::string>(
+      "Schwarz Variant", "Multiplicative");
+
+  is_additive_ = variant == "Additive";
+  concurrent_solves_ =
+      alt_system_params.get<bool>("Concurrent Subdomain Solves", false);
+
   // Firewalls
   ALBANY_ASSERT(min_iters_ >= 1);
   ALBANY_ASSERT(max_iters_ >= 1);
@@ -66,6 +78,26 @@ SchwarzAlternating(
   ALBANY_ASSERT(reduction_factor_ > 0.0);
   ALBANY_ASSERT(increase_factor_ >= 1.0);
   ALBANY_ASSERT(output_interval_ >= 1);
+  ALBANY_ASSERT(
+      variant == "Multiplicative" || variant == "Additive",
+      "Schwarz Variant must be Multiplicative or Additive");
+  ALBANY_ASSERT(
+      concurrent_solves_ == false || is_additive_ == true,
+      "Concurrent Subdomain Solves requires the Additive Schwarz Variant");
+
+  if (concurrent_solves_ == true) {
+    std::string const
+    reason = Albany::concurrentSolvesUnavailable();
+
+    if (reason.empty() == false) {
+      if (comm->getRank() == 0) {
+        *Teuchos::VerboseObjectBase::getDefaultOStream()
+            << "WARNING: Concurrent Subdomain Solves disabled, " << reason
+            << ". Solving the subdomains one after the other.\n";
+      }
+      concurrent_solves_ = false;
+    }
+  }
 
   //number of models
   num_subdomains_ = model_filenames.size();
@@ -117,9 +149,14 @@ SchwarzAlternating(
 
   // Initialization
   for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    // Concurrent solves run collectives of different subdomains at the
+    // same time, so each subdomain needs its own communicator.
+    Teuchos::RCP<Teuchos::Comm<int> const>
+    subdomain_comm = concurrent_solves_ == true ? comm->duplicate() : comm;
+
     // Get parameters for each subdomain
     Albany::SolverFactory
-    solver_factory(model_filenames[subdomain], comm);
+    solver_factory(model_filenames[subdomain], subdomain_comm);
 
     solver_factory.setSchwarz(true); 
 
@@ -164,7 +201,8 @@ SchwarzAlternating(
     app{Teuchos::null};
     
     Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>>
-    solver = solver_factory.createAndGetAlbanyAppT(app, comm, comm);
+    solver = solver_factory.createAndGetAlbanyAppT(
+        app, subdomain_comm, subdomain_comm);
 
     solvers_[subdomain] = solver;
 
@@ -595,336 +633,617 @@ reportFinals(std::ostream & os) const
 }
 
 //
-// Schwarz Alternating loop, dynamic
+// Save the solution of the previous Schwarz iteration of a subdomain
+// before solving it again, dynamic
 //
 void
 SchwarzAlternating::
-SchwarzLoopDynamics() const
+savePreviousSolutionDynamics(int const subdomain, bool const is_initial_state)
+const
 {
-  minitensor::Vector<ST>
-  norms_init(num_subdomains_, minitensor::Filler::ZEROS);
-
-  minitensor::Vector<ST>
-  norms_final(num_subdomains_, minitensor::Filler::ZEROS);
-
-  minitensor::Vector<ST>
-  norms_diff(num_subdomains_, minitensor::Filler::ZEROS);
+  if (is_initial_state == true) {
+    auto &
+    me = dynamic_cast<Albany::ModelEvaluatorT &>
+    (*model_evaluators_[subdomain]);
+    auto const & nv = me.getNominalValues();
+    prev_disp_[subdomain] = Thyra::createMember(me.get_x_space());
+    Thyra::copy(*(nv.get_x()), prev_disp_[subdomain].ptr());
+    prev_velo_[subdomain] = Thyra::createMember(me.get_x_space());
+    Thyra::copy(*(nv.get_x_dot()), prev_velo_[subdomain].ptr());
+    prev_acce_[subdomain] = Thyra::createMember(me.get_x_space());
+    Thyra::copy(*(nv.get_x_dot_dot()), prev_acce_[subdomain].ptr());
+  }
+  else {
+    Thyra::put_scalar(0.0, prev_disp_[subdomain].ptr());
+    Thyra::copy(*this_disp_[subdomain], prev_disp_[subdomain].ptr());
+    Thyra::put_scalar(0.0, prev_velo_[subdomain].ptr());
+    Thyra::copy(*this_velo_[subdomain], prev_velo_[subdomain].ptr());
+    Thyra::put_scalar(0.0, prev_acce_[subdomain].ptr());
+    Thyra::copy(*this_acce_[subdomain], prev_acce_[subdomain].ptr());
+  }
+  return;
+}
 
+//
+// Solve one subdomain for one Schwarz iteration, dynamic. Returns false
+// if the solver fails.
+//
+bool
+SchwarzAlternating::
+solveSubdomainDynamics(
+    int const subdomain,
+    ST const current_time,
+    ST const next_time,
+    ST const time_step,
+    minitensor::Vector<ST> & norms_init,
+    minitensor::Vector<ST> & norms_final,
+    minitensor::Vector<ST> & norms_diff) const
+{
   std::string const
   delim(72, '=');
 
   auto &
-  fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+  fos = subdomainOutput(subdomain);
+
+  // Solve for each subdomain
+  Thyra::ResponseOnlyModelEvaluatorBase<ST> &
+  solver = *(solvers_[subdomain]);
+
+  Piro::TempusSolver<ST, LO, Tpetra_GO, KokkosNode> &
+  piro_tempus_solver =
+      dynamic_cast<Piro::TempusSolver<ST, LO, Tpetra_GO, KokkosNode> &>(solver);
+
+  piro_tempus_solver.setStartTime(current_time);
+  piro_tempus_solver.setFinalTime(next_time);
+  piro_tempus_solver.setInitTimeStep(time_step);
 
+  fos << "Initial time       :" << current_time << '\n';
+  fos << "Final time         :" << next_time << '\n';
+  fos << "Time step          :" << time_step << '\n';
   fos << delim << std::endl;
-  fos << "Schwarz Alternating Method with " << num_subdomains_;
-  fos << " subdomains\n";
-  fos << std::scientific << std::setprecision(17);
 
-  ST
-  time_step{initial_time_step_};
+  Thyra::ModelEvaluatorBase::InArgs<ST>
+  in_args = solver.createInArgs();
 
-  int
-  stop{0};
+  Thyra::ModelEvaluatorBase::OutArgs<ST>
+  out_args = solver.createOutArgs();
 
-  ST
-  current_time{initial_time_};
+  auto &
+  me = dynamic_cast<Albany::ModelEvaluatorT &>
+  (*model_evaluators_[subdomain]);
 
-  //Set ICs and PrevSoln vecs and write initial configuration to Exodus file
-  setDynamicICVecsAndDoOutput(initial_time_);
+  // Restore internal states
+  auto &
+  app = *apps_[subdomain];
 
-  // Time-stepping loop
-  while (stop < maximum_steps_ && current_time < final_time_) {
+  auto &
+  state_mgr = app.getStateMgr();
 
-    fos << delim << std::endl;
-    fos << "Time stop          :" << stop << '\n';
-    fos << "Time               :" << current_time << '\n';
-    fos << "Time step          :" << time_step << '\n';
-    fos << delim << std::endl;
+  state_mgr.setStateArrays(internal_states_[subdomain]);
 
-    ST const
-    next_time{current_time + time_step};
+  //IKT: the following is different than the quasistatic case...
+  me.getNominalValues().set_t(current_time);
 
-    num_iter_ = 0;
+  Teuchos::RCP<Tempus::SolutionHistory<ST> >
+  solution_history;
 
-    // Schwarz loop
-    do {
+  Teuchos::RCP<Tempus::SolutionState<ST>>
+  current_state;
 
-      bool const
-      is_initial_state = stop == 0 && num_iter_ == 0;
+  Teuchos::RCP<Thyra::VectorBase<ST>>
+  ic_disp_rcp = Thyra::createMember(me.get_x_space());
 
-      for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+  Teuchos::RCP<Thyra::VectorBase<ST>>
+  ic_velo_rcp = Thyra::createMember(me.get_x_space());
 
-        fos << delim << std::endl;
-        fos << "Schwarz iteration  :" << num_iter_ << '\n';
-        fos << "Subdomain          :" << subdomain << '\n';
-        fos << delim << std::endl;
+  Teuchos::RCP<Thyra::VectorBase<ST>>
+  ic_acce_rcp = Thyra::createMember(me.get_x_space());
 
-        //Restore solution from previous Schwarz iteration before solve
-        if (is_initial_state == true) {
-          auto &
-          me = dynamic_cast<Albany::ModelEvaluatorT &>
-          (*model_evaluators_[subdomain]);
-          auto const & nv = me.getNominalValues();
-          prev_disp_[subdomain] = Thyra::createMember(me.get_x_space());
-          Thyra::copy(*(nv.get_x()), prev_disp_[subdomain].ptr());
-          prev_velo_[subdomain] = Thyra::createMember(me.get_x_space());
-          Thyra::copy(*(nv.get_x_dot()), prev_velo_[subdomain].ptr());
-          prev_acce_[subdomain] = Thyra::createMember(me.get_x_space());
-          Thyra::copy(*(nv.get_x_dot_dot()), prev_acce_[subdomain].ptr());
-        }
-        else {
-          Thyra::put_scalar(0.0, prev_disp_[subdomain].ptr());
-          Thyra::copy(*this_disp_[subdomain], prev_disp_[subdomain].ptr());
-          Thyra::put_scalar(0.0, prev_velo_[subdomain].ptr());
-          Thyra::copy(*this_velo_[subdomain], prev_velo_[subdomain].ptr());
-          Thyra::put_scalar(0.0, prev_acce_[subdomain].ptr());
-          Thyra::copy(*this_acce_[subdomain], prev_acce_[subdomain].ptr());
-        }
+  //set ic_disp_rcp, ic_velo_rcp and ic_acce_rcp
+  //by making copy of what is in ics_disp_[subdomain], etc.
+  Thyra::VectorBase<ST> &
+  ic_disp = *ics_disp_[subdomain];
 
+  Thyra::VectorBase<ST> &
+  ic_velo = *ics_velo_[subdomain];
 
-        // Solve for each subdomain
-        Thyra::ResponseOnlyModelEvaluatorBase<ST> &
-        solver = *(solvers_[subdomain]);
+  Thyra::VectorBase<ST> &
+  ic_acce = *ics_acce_[subdomain];
 
-        Piro::TempusSolver<ST, LO, Tpetra_GO, KokkosNode> &
-        piro_tempus_solver =
-            dynamic_cast<Piro::TempusSolver<ST, LO, Tpetra_GO, KokkosNode> &>(solver);
+  Thyra::copy(ic_disp, ic_disp_rcp.ptr());
 
-        piro_tempus_solver.setStartTime(current_time);
-        piro_tempus_solver.setFinalTime(next_time);
-        piro_tempus_solver.setInitTimeStep(time_step);
+  Thyra::copy(ic_velo, ic_velo_rcp.ptr());
 
-        fos << "Initial time       :" << current_time << '\n';
-        fos << "Final time         :" << next_time << '\n';
-        fos << "Time step          :" << time_step << '\n';
-        fos << delim << std::endl;
+  Thyra::copy(ic_acce, ic_acce_rcp.ptr());
 
-        Thyra::ModelEvaluatorBase::InArgs<ST>
-        in_args = solver.createInArgs();
+  piro_tempus_solver.setInitialState(
+      current_time,
+      ic_disp_rcp,
+      ic_velo_rcp,
+      ic_acce_rcp);
 
-        Thyra::ModelEvaluatorBase::OutArgs<ST>
-        out_args = solver.createOutArgs();
+  solver.evalModel(in_args, out_args);
 
-        auto &
-        me = dynamic_cast<Albany::ModelEvaluatorT &>
-        (*model_evaluators_[subdomain]);
+  //Allocate current solution vectors
 
-        // Restore internal states
-        auto &
-        app = *apps_[subdomain];
+  this_disp_[subdomain] = Thyra::createMember(me.get_x_space());
+  this_velo_[subdomain] = Thyra::createMember(me.get_x_space());
+  this_acce_[subdomain] = Thyra::createMember(me.get_x_space());
 
-        auto &
-        state_mgr = app.getStateMgr();
+#if defined(DEBUG)
+  Teuchos::RCP<Tpetra_Vector>
+  prev_disp_tpetra;
+
+  fos << "\n*** Thyra: Previous solution ***\n";
+  prev_disp_[subdomain]->describe(fos, Teuchos::VERB_EXTREME);
+  fos << "\n*** NORM: " << Thyra::norm(*prev_disp_[subdomain]) << '\n';
+  if (subdomain == 0) {
+    prev_disp_tpetra = ConverterT::getTpetraVector(prev_disp_[0]);
+    Albany::writeMatrixMarket(prev_disp_tpetra, "prev_disp0", num_iter_);
+  }
+  else if (subdomain == 1) {
+    prev_disp_tpetra = ConverterT::getTpetraVector(prev_disp_[1]);
+    Albany::writeMatrixMarket(prev_disp_tpetra, "prev_disp1", num_iter_);
+  }
+  fos << "\n*** Thyra: Previous solution ***\n";
+#endif //DEBUG
 
-        state_mgr.setStateArrays(internal_states_[subdomain]);
+  // Check whether solver did OK.
 
-        //IKT: the following is different than the quasistatic case...
-        me.getNominalValues().set_t(current_time);
+  //IKT, 12/21/17: uncomment the following if want to check what happened with NOX
+  //solver underlying Tempus solver.
 
-        Teuchos::RCP<Tempus::SolutionHistory<ST> >
-        solution_history;
+  /*const Teuchos::RCP<const ::Thyra::NonlinearSolverBase<ST> >
+  thyra_solver = piro_tempus_solver.getSolver();
 
-        Teuchos::RCP<Tempus::SolutionState<ST>>
-        current_state;
+  Teuchos::RCP<const ::Thyra::NOXNonlinearSolver > thyra_nox_solver =
+  Teuchos::rcp_dynamic_cast<const ::Thyra::NOXNonlinearSolver>(thyra_solver);
 
-        Teuchos::RCP<Thyra::VectorBase<ST>>
-        ic_disp_rcp = Thyra::createMember(me.get_x_space());
+  Teuchos::RCP<const NOX::Solver::Generic> const_nox_solver =
+  thyra_nox_solver->getNOXSolver();
 
-        Teuchos::RCP<Thyra::VectorBase<ST>>
-        ic_velo_rcp = Thyra::createMember(me.get_x_space());
+  if (thyra_nox_solver != Teuchos::null) {
+    auto &
+    nox_solver = const_cast<NOX::Solver::Generic &>(*const_nox_solver);
 
-        Teuchos::RCP<Thyra::VectorBase<ST>>
-        ic_acce_rcp = Thyra::createMember(me.get_x_space());
+    auto const
+    status_nox = nox_solver.getStatus();
 
-        //set ic_disp_rcp, ic_velo_rcp and ic_acce_rcp
-        //by making copy of what is in ics_disp_[subdomain], etc.
-        Thyra::VectorBase<ST> &
-        ic_disp = *ics_disp_[subdomain];
+    fos << "IKT NOX status = " << status_nox << "\n";
+ } */
 
-        Thyra::VectorBase<ST> &
-        ic_velo = *ics_velo_[subdomain];
+  auto const
+  status = piro_tempus_solver.getTempusIntegratorStatus();
 
-        Thyra::VectorBase<ST> &
-        ic_acce = *ics_acce_[subdomain];
+  //IKT, 12/21/17: debug print statements
+  /*if (status == Tempus::Status::FAILED)
+    fos << "IKT tempus status = FAILED \n";
+  else
+    fos << "IKT tempus status = PASSED \n";
+  */
 
-        Thyra::copy(ic_disp, ic_disp_rcp.ptr());
+  //if (status == NOX::StatusTest::Failed) {
+  if (status == Tempus::Status::FAILED) {
+    fos << "\nINFO: Unable to solve for subdomain " << subdomain << '\n';
+    return false;
+  }
 
-        Thyra::copy(ic_velo, ic_velo_rcp.ptr());
+  // If solver is OK, extract solution
 
-        Thyra::copy(ic_acce, ic_acce_rcp.ptr());
+  solution_history = piro_tempus_solver.getSolutionHistory();
 
-        piro_tempus_solver.setInitialState(
-            current_time,
-            ic_disp_rcp,
-            ic_velo_rcp,
-            ic_acce_rcp);
+  current_state = solution_history->getCurrentState();
 
-        solver.evalModel(in_args, out_args);
+  Thyra::copy(*current_state->getX(), this_disp_[subdomain].ptr());
 
-        //Allocate current solution vectors
+  Thyra::copy(*current_state->getXDot(), this_velo_[subdomain].ptr());
 
-        this_disp_[subdomain] = Thyra::createMember(me.get_x_space());
-        this_velo_[subdomain] = Thyra::createMember(me.get_x_space());
-        this_acce_[subdomain] = Thyra::createMember(me.get_x_space());
+  Thyra::copy(*current_state->getXDotDot(), this_acce_[subdomain].ptr());
 
 #if defined(DEBUG)
-        Teuchos::RCP<Tpetra_Vector>
-        prev_disp_tpetra;
-
-        fos << "\n*** Thyra: Previous solution ***\n";
-        prev_disp_[subdomain]->describe(fos, Teuchos::VERB_EXTREME);
-        fos << "\n*** NORM: " << Thyra::norm(*prev_disp_[subdomain]) << '\n';
-        if (subdomain == 0) {
-          prev_disp_tpetra = ConverterT::getTpetraVector(prev_disp_[0]);
-          Albany::writeMatrixMarket(prev_disp_tpetra, "prev_disp0", num_iter_);
-        }
-        else if (subdomain == 1) {
-          prev_disp_tpetra = ConverterT::getTpetraVector(prev_disp_[1]);
-          Albany::writeMatrixMarket(prev_disp_tpetra, "prev_disp1", num_iter_);
-        }
-        fos << "\n*** Thyra: Previous solution ***\n";
+  fos << "\n*** Thyra: Current solution ***\n";
+  this_disp_[subdomain]->describe(fos, Teuchos::VERB_EXTREME);
+  fos << "\n*** NORM: " << Thyra::norm(*this_disp_[subdomain]) << '\n';
+  fos << "\n*** Thyra: Current solution ***\n";
+
+  Teuchos::RCP<Tpetra_Vector>
+  curr_disp_tpetra;
+
+  if (subdomain == 0) {
+    curr_disp_tpetra = ConverterT::getTpetraVector(this_disp_[0]);
+    Albany::writeMatrixMarket(curr_disp_tpetra, "curr_disp0", num_iter_);
+  }
+  else if (subdomain == 1) {
+    curr_disp_tpetra = ConverterT::getTpetraVector(this_disp_[1]);
+    Albany::writeMatrixMarket(curr_disp_tpetra, "curr_disp1", num_iter_);
+  }
 #endif //DEBUG
 
-        // Check whether solver did OK.
+  Teuchos::RCP<Thyra::VectorBase<ST>>
+  disp_diff_rcp = Thyra::createMember(me.get_x_space());
+  Thyra::put_scalar<ST>(0.0, disp_diff_rcp.ptr());
+  Thyra::V_VpStV(
+      disp_diff_rcp.ptr(),
+      *this_disp_[subdomain],
+      -1.0,
+      *prev_disp_[subdomain]);
+
+  Teuchos::RCP<Thyra::VectorBase<ST>>
+  velo_diff_rcp = Thyra::createMember(me.get_x_space());
+  Thyra::put_scalar<ST>(0.0, velo_diff_rcp.ptr());
+  Thyra::V_VpStV(
+      velo_diff_rcp.ptr(),
+      *this_velo_[subdomain],
+      -1.0,
+      *prev_velo_[subdomain]);
+
+  Teuchos::RCP<Thyra::VectorBase<ST>>
+  acce_diff_rcp = Thyra::createMember(me.get_x_space());
+  Thyra::put_scalar<ST>(0.0, acce_diff_rcp.ptr());
+  Thyra::V_VpStV(
+      acce_diff_rcp.ptr(),
+      *this_acce_[subdomain],
+      -1.0,
+      *prev_acce_[subdomain]);
 
-        //IKT, 12/21/17: uncomment the following if want to check what happened with NOX
-        //solver underlying Tempus solver.
+#if defined(DEBUG)
+  fos << "\n*** Thyra: Solution difference ***\n";
+  disp_diff_rcp->describe(fos, Teuchos::VERB_EXTREME);
+  fos << "\n*** NORM: " << Thyra::norm(*disp_diff_rcp) << '\n';
+  fos << "\n*** Thyra: Solution difference ***\n";
 
-        /*const Teuchos::RCP<const ::Thyra::NonlinearSolverBase<ST> >
-        thyra_solver = piro_tempus_solver.getSolver();
+  Teuchos::RCP<Tpetra_Vector>
+  disp_diff_tpetra;
 
-        Teuchos::RCP<const ::Thyra::NOXNonlinearSolver > thyra_nox_solver =
-        Teuchos::rcp_dynamic_cast<const ::Thyra::NOXNonlinearSolver>(thyra_solver);
+  if (subdomain == 0) {
+    disp_diff_tpetra = ConverterT::getTpetraVector(disp_diff_rcp);
+    Albany::writeMatrixMarket(disp_diff_tpetra, "disp_diff0", num_iter_);
+  }
+  else if (subdomain == 1) {
+    disp_diff_tpetra = ConverterT::getTpetraVector(disp_diff_rcp);
+    Albany::writeMatrixMarket(disp_diff_tpetra, "disp_diff1", num_iter_);
+  }
+#endif //DEBUG
 
-        Teuchos::RCP<const NOX::Solver::Generic> const_nox_solver =
-        thyra_nox_solver->getNOXSolver();
+  //After solve, save solution and get info to check convergence
+  norms_init(subdomain) = Thyra::norm(*prev_disp_[subdomain]);
+  norms_final(subdomain) = Thyra::norm(*this_disp_[subdomain]);
+  norms_diff(subdomain) = Thyra::norm(*disp_diff_rcp);
 
-        if (thyra_nox_solver != Teuchos::null) {
-          auto &
-          nox_solver = const_cast<NOX::Solver::Generic &>(*const_nox_solver);
-
-          auto const
-          status_nox = nox_solver.getStatus();
-
-          fos << "IKT NOX status = " << status_nox << "\n";
-       } */
-
-        auto const
-        status = piro_tempus_solver.getTempusIntegratorStatus();
-
-        //IKT, 12/21/17: debug print statements
-        /*if (status == Tempus::Status::FAILED)
-          fos << "IKT tempus status = FAILED \n";
-        else
-          fos << "IKT tempus status = PASSED \n";
-        */
-
-        //if (status == NOX::StatusTest::Failed) {
-        if (status == Tempus::Status::FAILED) {
-          fos << "\nINFO: Unable to solve for subdomain " << subdomain << '\n';
-          failed_ = true;
-          // Break out of the subdomain loop
-          break;
-        }
+  auto const
+  dt = time_step;
 
-        // If solver is OK, extract solution
+  norms_init(subdomain)  += dt * Thyra::norm(*prev_velo_[subdomain]);
+  norms_final(subdomain) += dt * Thyra::norm(*this_velo_[subdomain]);
+  norms_diff(subdomain)  += dt * Thyra::norm(*velo_diff_rcp);
 
-        solution_history = piro_tempus_solver.getSolutionHistory();
+  auto const
+  dt2 = dt * dt;
 
-        current_state = solution_history->getCurrentState();
+  norms_init(subdomain)  += dt2 * Thyra::norm(*prev_acce_[subdomain]);
+  norms_final(subdomain) += dt2 * Thyra::norm(*this_acce_[subdomain]);
+  norms_diff(subdomain)  += dt2 * Thyra::norm(*acce_diff_rcp);
 
-        Thyra::copy(*current_state->getX(), this_disp_[subdomain].ptr());
+  return true;
+}
 
-        Thyra::copy(*current_state->getXDot(), this_velo_[subdomain].ptr());
+//
+// Solve one subdomain for one Schwarz iteration, quasistatic. Returns false
+// if the solver fails.
+//
+bool
+SchwarzAlternating::
+solveSubdomainQuasistatics(
+    int const subdomain,
+    bool const is_initial_state,
+    ST const next_time,
+    minitensor::Vector<ST> & norms_init,
+    minitensor::Vector<ST> & norms_final,
+    minitensor::Vector<ST> & norms_diff) const
+{
+  auto &
+  fos = subdomainOutput(subdomain);
 
-        Thyra::copy(*current_state->getXDotDot(), this_acce_[subdomain].ptr());
+  // Save solution from previous Schwarz iteration before solve
+  auto &
+  me = dynamic_cast<Albany::ModelEvaluatorT &>
+  (*model_evaluators_[subdomain]);
 
-#if defined(DEBUG)
-        fos << "\n*** Thyra: Current solution ***\n";
-        this_disp_[subdomain]->describe(fos, Teuchos::VERB_EXTREME);
-        fos << "\n*** NORM: " << Thyra::norm(*this_disp_[subdomain]) << '\n';
-        fos << "\n*** Thyra: Current solution ***\n";
+  auto
+  prev_disp_rcp = is_initial_state == true ?
+      me.getNominalValues().get_x() :
+      curr_disp_[subdomain];
 
-        Teuchos::RCP<Tpetra_Vector>
-        curr_disp_tpetra;
+  auto const &
+  prev_disp = *prev_disp_rcp;
 
-        if (subdomain == 0) {
-          curr_disp_tpetra = ConverterT::getTpetraVector(this_disp_[0]);
-          Albany::writeMatrixMarket(curr_disp_tpetra, "curr_disp0", num_iter_);
-        }
-        else if (subdomain == 1) {
-          curr_disp_tpetra = ConverterT::getTpetraVector(this_disp_[1]);
-          Albany::writeMatrixMarket(curr_disp_tpetra, "curr_disp1", num_iter_);
-        }
-#endif //DEBUG
+  // Restore internal states
+  auto &
+  app = *apps_[subdomain];
+
+  auto &
+  state_mgr = app.getStateMgr();
+
+  state_mgr.setStateArrays(internal_states_[subdomain]);
+
+  // Restore solution from previous time step
+  auto
+  prev_step_disp_rcp = is_initial_state == true ?
+      me.getNominalValues().get_x() :
+      prev_step_disp_[subdomain];
+
+  me.getNominalValues().set_x(prev_step_disp_rcp);
+
+  // Target time
+  me.setCurrentTime(next_time);
+
+  // Solve for each subdomain
+  auto &
+  solver = *(solvers_[subdomain]);
+
+  auto &
+  piro_nox_solver = dynamic_cast<Piro::NOXSolver<ST> &>(solver);
+
+  auto
+  in_args = solver.createInArgs();
+
+  auto
+  out_args = solver.createOutArgs();
+
+  solver.evalModel(in_args, out_args);
+
+  // Check whether solver did OK.
+  auto const &
+  thyra_nox_solver = *piro_nox_solver.getSolver();
 
-        Teuchos::RCP<Thyra::VectorBase<ST>>
-        disp_diff_rcp = Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, disp_diff_rcp.ptr());
-        Thyra::V_VpStV(
-            disp_diff_rcp.ptr(),
-            *this_disp_[subdomain],
-            -1.0,
-            *prev_disp_[subdomain]);
-
-        Teuchos::RCP<Thyra::VectorBase<ST>>
-        velo_diff_rcp = Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, velo_diff_rcp.ptr());
-        Thyra::V_VpStV(
-            velo_diff_rcp.ptr(),
-            *this_velo_[subdomain],
-            -1.0,
-            *prev_velo_[subdomain]);
-
-        Teuchos::RCP<Thyra::VectorBase<ST>>
-        acce_diff_rcp = Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, acce_diff_rcp.ptr());
-        Thyra::V_VpStV(
-            acce_diff_rcp.ptr(),
-            *this_acce_[subdomain],
-            -1.0,
-            *prev_acce_[subdomain]);
+  auto const &
+  const_nox_solver = *thyra_nox_solver.getNOXSolver();
+
+  auto &
+  nox_solver = const_cast<NOX::Solver::Generic &>(const_nox_solver);
+
+  auto const
+  status = nox_solver.getStatus();
+
+  if (status == NOX::StatusTest::Failed) {
+    fos << "\nINFO: Unable to solve for subdomain " << subdomain << '\n';
+    return false;
+  }
+
+  // Solver OK, extract solution
+  auto
+  curr_disp_rcp = thyra_nox_solver.get_current_x()->clone_v();
+
+  auto const &
+  curr_disp = *curr_disp_rcp;
+
+  // Compute difference between previous and current solutions
+  auto
+  disp_diff_rcp = Thyra::createMember(me.get_x_space());
+
+  auto
+  disp_diff_ptr = disp_diff_rcp.ptr();
+
+  Thyra::put_scalar<ST>(0.0, disp_diff_ptr);
+
+  Thyra::V_VpStV(disp_diff_ptr, curr_disp, -1.0, prev_disp);
+
+  auto &
+  disp_diff = *disp_diff_rcp;
+
+  // After solve, save solution and get info to check convergence
+  curr_disp_[subdomain] = curr_disp_rcp;
+  norms_init(subdomain) = Thyra::norm(prev_disp);
+  norms_final(subdomain) = Thyra::norm(curr_disp);
+  norms_diff(subdomain) = Thyra::norm(disp_diff);
 
 #if defined(DEBUG)
-        fos << "\n*** Thyra: Solution difference ***\n";
-        disp_diff_rcp->describe(fos, Teuchos::VERB_EXTREME);
-        fos << "\n*** NORM: " << Thyra::norm(*disp_diff_rcp) << '\n';
-        fos << "\n*** Thyra: Solution difference ***\n";
+  fos << "\n*** NOX: Previous solution ***\n";
+  prev_disp.describe(fos, Teuchos::VERB_EXTREME);
+  fos << "\n*** NORM: " << Thyra::norm(prev_disp) << '\n';
+  fos << "\n*** NOX: Previous solution ***\n";
+
+  fos << "\n*** NOX: Current solution ***\n";
+  curr_disp.describe(fos, Teuchos::VERB_EXTREME);
+  fos << "\n*** NORM: " << Thyra::norm(curr_disp) << '\n';
+  fos << "\n*** NOX: Current solution ***\n";
+
+  fos << "\n*** NOX: Solution difference ***\n";
+  disp_diff.describe(fos, Teuchos::VERB_EXTREME);
+  fos << "\n*** NORM: " << Thyra::norm(disp_diff) << '\n';
+  fos << "\n*** NOX: Solution difference ***\n";
+#endif //DEBUG
+
+  return true;
+}
+
+//
+// Stream for the output of one subdomain solve: the default one, or its
+// buffer while the subdomains are solved concurrently.
+//
+Teuchos::FancyOStream &
+SchwarzAlternating::
+subdomainOutput(int const subdomain) const
+{
+  if (subdomain_streams_.empty() == true) {
+    return *Teuchos::VerboseObjectBase::getDefaultOStream();
+  }
+  return *subdomain_streams_[subdomain];
+}
+
+//
+// Additive Schwarz: solve all subdomains from the same boundary data, one
+// after the other or on one thread each. Returns false if any solve fails.
+//
+bool
+SchwarzAlternating::
+solveSubdomainsAdditive(std::function<bool(int)> const & solve) const
+{
+  // Not std::vector<bool>, the threads write to different entries.
+  std::vector<char>
+  solved(num_subdomains_, 0);
+
+  if (concurrent_solves_ == false || concurrent_ready_ == false) {
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      solved[subdomain] = solve(subdomain);
+    }
+    concurrent_ready_ = true;
+  } else {
+    // The default output stream is shared and not thread safe.
+    subdomain_buffers_.resize(num_subdomains_);
+    subdomain_streams_.resize(num_subdomains_);
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      subdomain_buffers_[subdomain] = Teuchos::rcp(new std::ostringstream);
+      subdomain_streams_[subdomain] =
+          Teuchos::fancyOStream(subdomain_buffers_[subdomain]);
+      subdomain_streams_[subdomain]->copyfmt(
+          *Teuchos::VerboseObjectBase::getDefaultOStream());
+    }
+
+    auto
+    run = [&](int const subdomain) {
+      solved[subdomain] = solve(subdomain);
+    };
+
+    std::exception_ptr
+    error;
+
+    try {
+      Albany::runConcurrentSolves(num_subdomains_, run);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    auto &
+    fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      fos << subdomain_buffers_[subdomain]->str();
+    }
+    subdomain_streams_.clear();
+    subdomain_buffers_.clear();
+
+    if (error) std::rethrow_exception(error);
+  }
+
+  return std::find(solved.begin(), solved.end(), 0) == solved.end();
+}
+
+//
+// Schwarz Alternating loop, dynamic
+//
+void
+SchwarzAlternating::
+SchwarzLoopDynamics() const
+{
+  minitensor::Vector<ST>
+  norms_init(num_subdomains_, minitensor::Filler::ZEROS);
+
+  minitensor::Vector<ST>
+  norms_final(num_subdomains_, minitensor::Filler::ZEROS);
+
+  minitensor::Vector<ST>
+  norms_diff(num_subdomains_, minitensor::Filler::ZEROS);
+
+  std::string const
+  delim(72, '=');
+
+  auto &
+  fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  fos << delim << std::endl;
+  fos << "Schwarz Alternating Method with " << num_subdomains_;
+  fos << " subdomains";
+  fos << (is_additive_ == true ? ", additive\n" : "\n");
+  fos << std::scientific << std::setprecision(17);
+
+  ST
+  time_step{initial_time_step_};
+
+  int
+  stop{0};
+
+  ST
+  current_time{initial_time_};
 
-        Teuchos::RCP<Tpetra_Vector>
-        disp_diff_tpetra;
+  //Set ICs and PrevSoln vecs and write initial configuration to Exodus file
+  setDynamicICVecsAndDoOutput(initial_time_);
+
+  // Time-stepping loop
+  while (stop < maximum_steps_ && current_time < final_time_) {
+
+    fos << delim << std::endl;
+    fos << "Time stop          :" << stop << '\n';
+    fos << "Time               :" << current_time << '\n';
+    fos << "Time step          :" << time_step << '\n';
+    fos << delim << std::endl;
+
+    ST const
+    next_time{current_time + time_step};
+
+    num_iter_ = 0;
+
+    // Schwarz loop
+    do {
+
+      bool const
+      is_initial_state = stop == 0 && num_iter_ == 0;
 
-        if (subdomain == 0) {
-          disp_diff_tpetra = ConverterT::getTpetraVector(disp_diff_rcp);
-          Albany::writeMatrixMarket(disp_diff_tpetra, "disp_diff0", num_iter_);
+      if (is_additive_ == true) {
+
+        fos << delim << std::endl;
+        fos << "Schwarz iteration  :" << num_iter_ << '\n';
+        fos << "Subdomains         :" << "all (additive)" << '\n';
+        fos << delim << std::endl;
+
+        // Every subdomain sees the solutions of the previous iteration.
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+          savePreviousSolutionDynamics(subdomain, is_initial_state);
+
+          apps_[subdomain]->freezeX(
+              ConverterT::getConstTpetraVector(prev_disp_[subdomain]),
+              ConverterT::getConstTpetraVector(prev_velo_[subdomain]),
+              ConverterT::getConstTpetraVector(prev_acce_[subdomain]));
         }
-        else if (subdomain == 1) {
-          disp_diff_tpetra = ConverterT::getTpetraVector(disp_diff_rcp);
-          Albany::writeMatrixMarket(disp_diff_tpetra, "disp_diff1", num_iter_);
+
+        auto
+        solve = [&](int const subdomain) {
+          return solveSubdomainDynamics(
+              subdomain, current_time, next_time, time_step,
+              norms_init, norms_final, norms_diff);
+        };
+
+        failed_ = solveSubdomainsAdditive(solve) == false;
+
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+          apps_[subdomain]->thawX();
         }
-#endif //DEBUG
 
-        //After solve, save solution and get info to check convergence
-        norms_init(subdomain) = Thyra::norm(*prev_disp_[subdomain]);
-        norms_final(subdomain) = Thyra::norm(*this_disp_[subdomain]);
-        norms_diff(subdomain) = Thyra::norm(*disp_diff_rcp);
+      } else {
 
-        auto const
-        dt = time_step;
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
 
-        norms_init(subdomain)  += dt * Thyra::norm(*prev_velo_[subdomain]);
-        norms_final(subdomain) += dt * Thyra::norm(*this_velo_[subdomain]);
-        norms_diff(subdomain)  += dt * Thyra::norm(*velo_diff_rcp);
+          fos << delim << std::endl;
+          fos << "Schwarz iteration  :" << num_iter_ << '\n';
+          fos << "Subdomain          :" << subdomain << '\n';
+          fos << delim << std::endl;
 
-        auto const
-        dt2 = dt * dt;
+          savePreviousSolutionDynamics(subdomain, is_initial_state);
 
-        norms_init(subdomain)  += dt2 * Thyra::norm(*prev_acce_[subdomain]);
-        norms_final(subdomain) += dt2 * Thyra::norm(*this_acce_[subdomain]);
-        norms_diff(subdomain)  += dt2 * Thyra::norm(*acce_diff_rcp);
+          bool const
+          solved = solveSubdomainDynamics(
+              subdomain, current_time, next_time, time_step,
+              norms_init, norms_final, norms_diff);
 
-      } //Subdomains loop
+          if (solved == false) {
+            failed_ = true;
+            // Break out of the subdomain loop
+            break;
+          }
+
+        } //Subdomains loop
+
+      }
 
       if (failed_ == true) {
         fos << "INFO: Unable to continue Schwarz iteration " << num_iter_;
@@ -1195,7 +1514,8 @@ SchwarzLoopQuasistatics() const
 
   fos << delim << std::endl;
   fos << "Schwarz Alternating Method with " << num_subdomains_;
-  fos << " subdomains\n";
+  fos << " subdomains";
+  fos << (is_additive_ == true ? ", additive\n" : "\n");
   fos << std::scientific << std::setprecision(17);
 
   ST
@@ -1249,128 +1569,73 @@ SchwarzLoopQuasistatics() const
       is_initial_state = stop == 0 && num_iter_ == 0;
 
       // Subdomain loop
-      for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      if (is_additive_ == true) {
 
         fos << delim << std::endl;
         fos << "Schwarz iteration  :" << num_iter_ << '\n';
-        fos << "Subdomain          :" << subdomain << '\n';
+        fos << "Subdomains         :" << "all (additive)" << '\n';
         fos << "Start time         :" << current_time << '\n';
         fos << "Stop time          :" << next_time << '\n';
         fos << "Time step          :" << time_step << '\n';
         fos << delim << std::endl;
 
-        // Save solution from previous Schwarz iteration before solve
-        auto &
-        me = dynamic_cast<Albany::ModelEvaluatorT &>
-        (*model_evaluators_[subdomain]);
-
-        auto
-        prev_disp_rcp = is_initial_state == true ?
-            me.getNominalValues().get_x() :
-            curr_disp_[subdomain];
-
-        auto const &
-        prev_disp = *prev_disp_rcp;
-
-        // Restore internal states
-        auto &
-        app = *apps_[subdomain];
-
-        auto &
-        state_mgr = app.getStateMgr();
-
-        state_mgr.setStateArrays(internal_states_[subdomain]);
-
-        // Restore solution from previous time step
-        auto
-        prev_step_disp_rcp = is_initial_state == true ?
-            me.getNominalValues().get_x() :
-            prev_step_disp_[subdomain];
-
-        me.getNominalValues().set_x(prev_step_disp_rcp);
-
-        // Target time
-        me.setCurrentTime(next_time);
-
-        // Solve for each subdomain
-        auto &
-        solver = *(solvers_[subdomain]);
+        // Every subdomain sees the solutions of the previous iteration.
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+          auto &
+          me = dynamic_cast<Albany::ModelEvaluatorT &>
+          (*model_evaluators_[subdomain]);
 
-        auto &
-        piro_nox_solver = dynamic_cast<Piro::NOXSolver<ST> &>(solver);
+          auto
+          prev_disp_rcp = is_initial_state == true ?
+              me.getNominalValues().get_x() :
+              curr_disp_[subdomain];
 
-        auto
-        in_args = solver.createInArgs();
+          apps_[subdomain]->freezeX(
+              ConverterT::getConstTpetraVector(prev_disp_rcp),
+              Teuchos::null,
+              Teuchos::null);
+        }
 
         auto
-        out_args = solver.createOutArgs();
-
-        solver.evalModel(in_args, out_args);
+        solve = [&](int const subdomain) {
+          return solveSubdomainQuasistatics(
+              subdomain, is_initial_state, next_time,
+              norms_init, norms_final, norms_diff);
+        };
 
-        // Check whether solver did OK.
-        auto const &
-        thyra_nox_solver = *piro_nox_solver.getSolver();
+        failed_ = solveSubdomainsAdditive(solve) == false;
 
-        auto const &
-        const_nox_solver = *thyra_nox_solver.getNOXSolver();
-
-        auto &
-        nox_solver = const_cast<NOX::Solver::Generic &>(const_nox_solver);
-
-        auto const
-        status = nox_solver.getStatus();
-
-        if (status == NOX::StatusTest::Failed) {
-          fos << "\nINFO: Unable to solve for subdomain " << subdomain << '\n';
-          failed_ = true;
-          // Break out of the subdomain loop
-          break;
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+          apps_[subdomain]->thawX();
         }
 
-        // Solver OK, extract solution
-        auto
-        curr_disp_rcp = thyra_nox_solver.get_current_x()->clone_v();
-
-        auto const &
-        curr_disp = *curr_disp_rcp;
-
-        // Compute difference between previous and current solutions
-        auto
-        disp_diff_rcp = Thyra::createMember(me.get_x_space());
+      } else {
 
-        auto
-        disp_diff_ptr = disp_diff_rcp.ptr();
+        // Subdomain loop
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
 
-        Thyra::put_scalar<ST>(0.0, disp_diff_ptr);
+          fos << delim << std::endl;
+          fos << "Schwarz iteration  :" << num_iter_ << '\n';
+          fos << "Subdomain          :" << subdomain << '\n';
+          fos << "Start time         :" << current_time << '\n';
+          fos << "Stop time          :" << next_time << '\n';
+          fos << "Time step          :" << time_step << '\n';
+          fos << delim << std::endl;
 
-        Thyra::V_VpStV(disp_diff_ptr, curr_disp, -1.0, prev_disp);
+          bool const
+          solved = solveSubdomainQuasistatics(
+              subdomain, is_initial_state, next_time,
+              norms_init, norms_final, norms_diff);
 
-        auto &
-        disp_diff = *disp_diff_rcp;
+          if (solved == false) {
+            failed_ = true;
+            // Break out of the subdomain loop
+            break;
+          }
 
-        // After solve, save solution and get info to check convergence
-        curr_disp_[subdomain] = curr_disp_rcp;
-        norms_init(subdomain) = Thyra::norm(prev_disp);
-        norms_final(subdomain) = Thyra::norm(curr_disp);
-        norms_diff(subdomain) = Thyra::norm(disp_diff);
+        } // Subdomain loop
 
-#if defined(DEBUG)
-        fos << "\n*** NOX: Previous solution ***\n";
-        prev_disp.describe(fos, Teuchos::VERB_EXTREME);
-        fos << "\n*** NORM: " << Thyra::norm(prev_disp) << '\n';
-        fos << "\n*** NOX: Previous solution ***\n";
-
-        fos << "\n*** NOX: Current solution ***\n";
-        curr_disp.describe(fos, Teuchos::VERB_EXTREME);
-        fos << "\n*** NORM: " << Thyra::norm(curr_disp) << '\n';
-        fos << "\n*** NOX: Current solution ***\n";
-
-        fos << "\n*** NOX: Solution difference ***\n";
-        disp_diff.describe(fos, Teuchos::VERB_EXTREME);
-        fos << "\n*** NORM: " << Thyra::norm(disp_diff) << '\n';
-        fos << "\n*** NOX: Solution difference ***\n";
-#endif //DEBUG
-      } // Subdomain loop
+      }
 
       if (failed_ == true) {
         fos << "INFO: Unable to continue Schwarz iteration " << num_iter_;
@@ -8,11 +8,13 @@
 #define LCM_SchwarzAlternating_hpp
 
 #include <functional>
+#include <sstream>
 
 #include "Albany_AbstractSTKMeshStruct.hpp"
 #include "Albany_DataTypes.hpp"
 #include "Albany_MaterialDatabase.hpp"
 #include "Albany_ModelEvaluatorT.hpp"
+#include "MiniTensor.h"
 #include "Piro_NOXSolver.hpp"
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
@@ -124,6 +126,36 @@ private:
   void
   SchwarzLoopDynamics() const;
 
+  void
+  savePreviousSolutionDynamics(
+      int const subdomain,
+      bool const is_initial_state) const;
+
+  bool
+  solveSubdomainDynamics(
+      int const subdomain,
+      ST const current_time,
+      ST const next_time,
+      ST const time_step,
+      minitensor::Vector<ST> & norms_init,
+      minitensor::Vector<ST> & norms_final,
+      minitensor::Vector<ST> & norms_diff) const;
+
+  bool
+  solveSubdomainQuasistatics(
+      int const subdomain,
+      bool const is_initial_state,
+      ST const next_time,
+      minitensor::Vector<ST> & norms_init,
+      minitensor::Vector<ST> & norms_final,
+      minitensor::Vector<ST> & norms_diff) const;
+
+  bool
+  solveSubdomainsAdditive(std::function<bool(int)> const & solve) const;
+
+  Teuchos::FancyOStream &
+  subdomainOutput(int const subdomain) const;
+
   void
   updateConvergenceCriterion() const;
 
@@ -196,6 +228,28 @@ private:
   int
   output_interval_{1};
 
+  // Additive Schwarz: all subdomains are solved from the solutions of the
+  // previous iteration instead of one after the other.
+  bool
+  is_additive_{false};
+
+  // Additive Schwarz only: solve the subdomains on one thread each.
+  bool
+  concurrent_solves_{false};
+
+  // The first additive iteration runs serially, so that the Teuchos timers
+  // exist before the solves run concurrently.
+  mutable bool
+  concurrent_ready_{false};
+
+  // Output of the concurrent solves, one buffer per subdomain, written in
+  // subdomain order once all solves are done. Empty outside of them.
+  mutable std::vector<Teuchos::RCP<std::ostringstream>>
+  subdomain_buffers_;
+
+  mutable std::vector<Teuchos::RCP<Teuchos::FancyOStream>>
+  subdomain_streams_;
+
   mutable bool
   failed_{false};
 
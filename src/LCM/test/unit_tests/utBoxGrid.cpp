@@ -0,0 +1,223 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <random>
+#include <vector>
+
+#include "BoxGrid.hpp"
+
+namespace
+{
+
+//
+// Boxes that contain the point, by testing all of them
+//
+std::vector<int>
+bruteForce(
+    int const dimension,
+    std::vector<double> const & lo,
+    std::vector<double> const & hi,
+    double const * point)
+{
+  std::vector<int>
+  boxes;
+
+  int const
+  number_boxes = lo.size() / dimension;
+
+  for (auto box = 0; box < number_boxes; ++box) {
+    bool
+    inside = true;
+
+    for (auto i = 0; i < dimension; ++i) {
+      inside = inside &&
+          lo[dimension * box + i] <= point[i] &&
+          point[i] <= hi[dimension * box + i];
+    }
+
+    if (inside == true) boxes.push_back(box);
+  }
+
+  return boxes;
+}
+
+//
+// Random boxes of sizes up to max_size in [0, 1]^dimension
+//
+void
+randomBoxes(
+    int const dimension,
+    int const number_boxes,
+    double const max_size,
+    std::mt19937 & generator,
+    std::vector<double> & lo,
+    std::vector<double> & hi)
+{
+  std::uniform_real_distribution<double>
+  position(0.0, 1.0);
+
+  std::uniform_real_distribution<double>
+  size(0.0, max_size);
+
+  lo.resize(dimension * number_boxes);
+  hi.resize(dimension * number_boxes);
+
+  for (auto k = 0; k < dimension * number_boxes; ++k) {
+    lo[k] = position(generator);
+    hi[k] = lo[k] + size(generator);
+  }
+}
+
+//
+// Compare the candidates of random points in and around the grid, and of
+// the box corners, with the brute force search
+//
+bool
+compareWithBruteForce(
+    int const dimension,
+    std::vector<double> const & lo,
+    std::vector<double> const & hi,
+    std::mt19937 & generator,
+    Teuchos::FancyOStream & out)
+{
+  LCM::BoxGrid
+  grid(dimension, lo, hi);
+
+  std::uniform_real_distribution<double>
+  position(-0.25, 1.5);
+
+  std::vector<double>
+  points;
+
+  int const
+  number_random_points = 2000;
+
+  for (auto k = 0; k < dimension * number_random_points; ++k) {
+    points.push_back(position(generator));
+  }
+
+  // Corners lie on bin and box boundaries
+  points.insert(points.end(), lo.begin(), lo.end());
+  points.insert(points.end(), hi.begin(), hi.end());
+
+  int const
+  number_points = points.size() / dimension;
+
+  std::vector<int>
+  candidates;
+
+  bool
+  success = true;
+
+  for (auto p = 0; p < number_points; ++p) {
+    double const *
+    point = &points[dimension * p];
+
+    grid.getCandidates(point, candidates);
+
+    std::vector<int> const
+    expected = bruteForce(dimension, lo, hi, point);
+
+    if (candidates != expected) {
+      out << "point " << p << ": " << candidates.size()
+          << " candidates, brute force finds " << expected.size() << '\n';
+      success = false;
+    }
+  }
+
+  return success;
+}
+
+TEUCHOS_UNIT_TEST(BoxGrid, RandomBoxes3D)
+{
+  std::mt19937
+  generator(1);
+
+  std::vector<double>
+  lo, hi;
+
+  randomBoxes(3, 500, 0.1, generator, lo, hi);
+
+  TEST_EQUALITY(LCM::BoxGrid(3, lo, hi).getNumberBoxes(), 500);
+  TEST_ASSERT(compareWithBruteForce(3, lo, hi, generator, out));
+}
+
+TEUCHOS_UNIT_TEST(BoxGrid, RandomBoxes2D)
+{
+  std::mt19937
+  generator(2);
+
+  std::vector<double>
+  lo, hi;
+
+  randomBoxes(2, 300, 0.2, generator, lo, hi);
+
+  TEST_ASSERT(compareWithBruteForce(2, lo, hi, generator, out));
+}
+
+TEUCHOS_UNIT_TEST(BoxGrid, LargeAndSmallBoxes)
+{
+  std::mt19937
+  generator(3);
+
+  std::vector<double>
+  lo, hi;
+
+  // Boxes spanning many bins next to boxes much smaller than a bin
+  randomBoxes(3, 200, 0.01, generator, lo, hi);
+
+  std::vector<double>
+  lo_large, hi_large;
+
+  randomBoxes(3, 20, 0.8, generator, lo_large, hi_large);
+
+  lo.insert(lo.end(), lo_large.begin(), lo_large.end());
+  hi.insert(hi.end(), hi_large.begin(), hi_large.end());
+
+  TEST_ASSERT(compareWithBruteForce(3, lo, hi, generator, out));
+}
+
+TEUCHOS_UNIT_TEST(BoxGrid, FlatBoxes)
+{
+  std::mt19937
+  generator(4);
+
+  std::vector<double>
+  lo, hi;
+
+  // All boxes in the plane z = 0.5, as for the faces of a surface mesh
+  randomBoxes(3, 200, 0.1, generator, lo, hi);
+
+  for (auto box = 0; box < 200; ++box) {
+    lo[3 * box + 2] = 0.5;
+    hi[3 * box + 2] = 0.5;
+  }
+
+  TEST_ASSERT(compareWithBruteForce(3, lo, hi, generator, out));
+}
+
+TEUCHOS_UNIT_TEST(BoxGrid, Empty)
+{
+  std::vector<double> const
+  none;
+
+  LCM::BoxGrid
+  grid(3, none, none);
+
+  double const
+  point[3] = {0.0, 0.0, 0.0};
+
+  std::vector<int>
+  candidates(1, 0);
+
+  grid.getCandidates(point, candidates);
+
+  TEST_EQUALITY(grid.getNumberBoxes(), 0);
+  TEST_EQUALITY(candidates.size(), 0);
+}
+
+} // anonymous namespace
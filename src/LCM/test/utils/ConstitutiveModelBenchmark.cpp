@@ -0,0 +1,528 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+//
+// Throughput benchmark for the LCM constitutive models.
+//
+// Reads the same material file as MaterialPointSimulator (element block
+// Block0), creates the model through ConstitutiveModelInterface and
+// evaluates it on worksets of --wsize cells with --npoints integration
+// points each, until --mpoints million points have been evaluated. This is
+// done for Residual and for Jacobian with each derivative length in
+// --derivs. Reported per evaluation type:
+//   - integration points per second
+//   - heap allocations per point
+//   - local solver iterations per point and per solve, for the models
+//     that count them in util::CounterMonitor
+//
+// The deformation gradient is the final one of the loading case in the
+// "Material Point Simulator" sublist of the material. States are not
+// updated, so every evaluation does the same work.
+//
+// With a static FAD build (ENABLE_SFAD) the derivative length must be
+// the static size, with ENABLE_SLFAD at most SLFAD_SIZE.
+//
+
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_TestForException.hpp>
+
+#include <Albany_Layouts.hpp>
+#include <Albany_STKDiscretization.hpp>
+#include <Albany_StateManager.hpp>
+#include <Albany_TmplSTKMeshStruct.hpp>
+#include <Albany_Utils.hpp>
+#include <PHAL_AlbanyTraits.hpp>
+#include <Phalanx_TypeStrings.hpp>
+
+#include <MiniTensor.h>
+
+#include "Albany_MaterialDatabase.hpp"
+#include "ConstitutiveModelInterface.hpp"
+#include "ConstitutiveModelParameters.hpp"
+#include "FieldNameMap.hpp"
+#include "SetField.hpp"
+
+#include "Kokkos_Core.hpp"
+
+#include "utility/CounterMonitor.hpp"
+#include "utility/PerformanceContext.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::atomic<std::size_t> num_allocations{0};
+
+struct KokkosGuard
+{
+  KokkosGuard(int ac, char* av[]) { Kokkos::initialize(ac, av); }
+
+  ~KokkosGuard() { Kokkos::finalize(); }
+};
+
+using Traits = PHAL::AlbanyTraits;
+
+struct Result
+{
+  double      seconds{0.0};
+  std::size_t points{0};
+  std::size_t allocations{0};
+  std::size_t local_solves{0};
+  std::size_t local_iterations{0};
+};
+
+// FAD value with derivative length num_derivs and a unit derivative in
+// direction index. Plain value for the Residual.
+template <typename ScalarT>
+ScalarT
+seed(RealType value, int num_derivs, int index)
+{
+  ScalarT x(num_derivs, value);
+  x.fastAccessDx(index % num_derivs) = 1.0;
+  return x;
+}
+
+template <>
+RealType
+seed<RealType>(RealType value, int, int)
+{
+  return value;
+}
+
+bool
+endsWith(std::string const& name, std::string const& suffix)
+{
+  return name.size() >= suffix.size() &&
+         name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Local solver counters of all models for one evaluation type
+void
+localSolverCounts(
+    std::string const& eval_type,
+    std::size_t&       solves,
+    std::size_t&       iterations)
+{
+  solves     = 0;
+  iterations = 0;
+  for (auto const& item :
+       util::PerformanceContext::instance().counterMonitor().items()) {
+    std::string const& name = item.first;
+    if (name.find(eval_type) == std::string::npos) continue;
+    if (endsWith(name, ": Local Solves")) solves += item.second->value();
+    if (endsWith(name, ": Local Iterations")) iterations += item.second->value();
+  }
+}
+
+template <typename EvalT>
+Teuchos::RCP<LCM::SetField<EvalT, Traits>>
+setField(
+    std::string const&                          name,
+    Teuchos::RCP<PHX::DataLayout> const&        layout,
+    Teuchos::ArrayRCP<typename EvalT::ScalarT> values)
+{
+  Teuchos::ParameterList p("SetField" + name);
+  p.set<std::string>("Evaluated Field Name", name);
+  p.set<Teuchos::RCP<PHX::DataLayout>>("Evaluated Field Data Layout", layout);
+  p.set<Teuchos::ArrayRCP<typename EvalT::ScalarT>>("Field Values", values);
+  return Teuchos::rcp(new LCM::SetField<EvalT, Traits>(p));
+}
+
+template <typename EvalT>
+Result
+benchmark(
+    Teuchos::ParameterList&              material,
+    Teuchos::RCP<Albany::Layouts> const& dl,
+    PHAL::Workset&                       workset,
+    minitensor::Tensor<RealType> const&  F,
+    RealType const                       delta_time,
+    RealType const                       temperature,
+    bool const                           have_temperature,
+    int const                            num_derivs,
+    std::size_t const                    num_evaluations)
+{
+  using ScalarT = typename EvalT::ScalarT;
+
+  int const         num_pts = dl->qp_scalar->dimension(1);
+  std::size_t const num_qps = workset.numCells * num_pts;
+
+  minitensor::Tensor<RealType> const eps =
+      0.5 * (F + minitensor::transpose(F)) - minitensor::eye<RealType>(3);
+  RealType const J = minitensor::det(F);
+
+  Teuchos::ArrayRCP<ScalarT> def_grad(num_qps * 9);
+  Teuchos::ArrayRCP<ScalarT> strain(num_qps * 9);
+  Teuchos::ArrayRCP<ScalarT> det_def_grad(num_qps);
+  Teuchos::ArrayRCP<ScalarT> temperatures(num_qps);
+  Teuchos::ArrayRCP<ScalarT> dt(1);
+
+  for (std::size_t qp = 0; qp < num_qps; ++qp) {
+    for (int k = 0; k < 9; ++k) {
+      def_grad[9 * qp + k] = seed<ScalarT>(F(k / 3, k % 3), num_derivs, k);
+      strain[9 * qp + k]   = seed<ScalarT>(eps(k / 3, k % 3), num_derivs, k);
+    }
+    det_def_grad[qp] = seed<ScalarT>(J, num_derivs, 0);
+    temperatures[qp] = temperature;
+  }
+  dt[0] = delta_time;
+
+  PHX::FieldManager<Traits> fm;
+
+  fm.registerEvaluator<EvalT>(setField<EvalT>("F", dl->qp_tensor, def_grad));
+  fm.registerEvaluator<EvalT>(
+      setField<EvalT>("J", dl->qp_scalar, det_def_grad));
+  fm.registerEvaluator<EvalT>(
+      setField<EvalT>("Strain", dl->qp_tensor, strain));
+  fm.registerEvaluator<EvalT>(
+      setField<EvalT>("Delta Time", dl->workset_scalar, dt));
+  if (have_temperature) {
+    fm.registerEvaluator<EvalT>(
+        setField<EvalT>("Temperature", dl->qp_scalar, temperatures));
+  }
+
+  Teuchos::ParameterList cmpPL;
+  cmpPL.set<Teuchos::ParameterList*>("Material Parameters", &material);
+  if (have_temperature) {
+    cmpPL.set<std::string>("Temperature Name", "Temperature");
+  }
+  fm.registerEvaluator<EvalT>(Teuchos::rcp(
+      new LCM::ConstitutiveModelParameters<EvalT, Traits>(cmpPL, dl)));
+
+  Teuchos::ParameterList cmiPL;
+  cmiPL.set<Teuchos::ParameterList*>("Material Parameters", &material);
+  if (have_temperature) {
+    cmiPL.set<std::string>("Temperature Name", "Temperature");
+  }
+  auto CMI = Teuchos::rcp(
+      new LCM::ConstitutiveModelInterface<EvalT, Traits>(cmiPL, dl));
+  fm.registerEvaluator<EvalT>(CMI);
+
+  for (auto const& tag : CMI->evaluatedFields()) {
+    fm.requireField<EvalT>(*tag);
+  }
+
+  Traits::SetupData setupData = "Benchmark";
+  fm.postRegistrationSetup(setupData);
+
+  auto evaluate = [&]() {
+    fm.preEvaluate<EvalT>(workset);
+    fm.evaluateFields<EvalT>(workset);
+    fm.postEvaluate<EvalT>(workset);
+  };
+
+  // First evaluation allocates the evaluator scratch data
+  evaluate();
+
+  std::string const eval_type = PHX::typeAsString<EvalT>();
+
+  std::size_t solves_start, iterations_start;
+  localSolverCounts(eval_type, solves_start, iterations_start);
+
+  std::size_t const allocations_start = num_allocations;
+  auto const        start             = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < num_evaluations; ++i) evaluate();
+
+  auto const stop = std::chrono::steady_clock::now();
+
+  Result result;
+  result.seconds     = std::chrono::duration<double>(stop - start).count();
+  result.points      = num_evaluations * num_qps;
+  result.allocations = num_allocations - allocations_start;
+
+  localSolverCounts(eval_type, result.local_solves, result.local_iterations);
+  result.local_solves -= solves_start;
+  result.local_iterations -= iterations_start;
+
+  return result;
+}
+
+void
+report(std::string const& name, Result const& r)
+{
+  double const points = std::max<double>(r.points, 1);
+  std::cout << "  " << std::left << std::setw(14) << name << std::right
+            << std::fixed << std::setprecision(4) << std::setw(10)
+            << r.seconds << " s" << std::setprecision(0) << std::setw(14)
+            << (r.seconds > 0.0 ? r.points / r.seconds : 0.0) << " points/s"
+            << std::setprecision(2) << std::setw(10)
+            << r.allocations / points << " allocs/point";
+  if (r.local_solves > 0) {
+    std::cout << std::setw(8) << r.local_iterations / points
+              << " local its/point" << std::setw(8)
+              << double(r.local_iterations) / r.local_solves
+              << " its/solve";
+  }
+  std::cout << std::endl;
+}
+
+}  // namespace
+
+// Count every heap allocation made by the benchmark
+void*
+operator new(std::size_t size)
+{
+  ++num_allocations;
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+int
+main(int ac, char* av[])
+{
+  KokkosGuard kokkos(ac, av);
+
+  using Residual = PHAL::AlbanyTraits::Residual;
+  using Jacobian = PHAL::AlbanyTraits::Jacobian;
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Constitutive Model Benchmark.\n"
+      "Throughput of an LCM material model for all evaluation types.\n");
+
+  std::string input_file = "materials.xml";
+  command_line_processor.setOption("input", &input_file, "Input File Name");
+
+  int workset_size = 1000;
+  command_line_processor.setOption("wsize", &workset_size, "Workset Size");
+
+  int num_pts = 8;
+  command_line_processor.setOption(
+      "npoints", &num_pts, "Number of Gaussian Points");
+
+  double mpoints = 1.0;
+  command_line_processor.setOption(
+      "mpoints", &mpoints, "Millions of points per evaluation type");
+
+  std::string derivs = "8,24";
+  command_line_processor.setOption(
+      "derivs", &derivs, "Comma separated Jacobian derivative lengths");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return =
+      command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  std::vector<int> deriv_lengths;
+  {
+    std::istringstream ss(derivs);
+    std::string        item;
+    while (std::getline(ss, item, ',')) {
+      if (item.empty() == false) deriv_lengths.push_back(std::stoi(item));
+    }
+  }
+
+  Teuchos::GlobalMPISession        mpi_session(&ac, &av);
+  Teuchos::RCP<const Teuchos_Comm> commT =
+      Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  auto material_db =
+      Teuchos::rcp(new Albany::MaterialDatabase(input_file, commT));
+
+  std::string const element_block_name = "Block0";
+  std::string const material_model_name =
+      material_db->getElementBlockSublist(element_block_name, "Material Model")
+          .get<std::string>("Model Name");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      material_model_name.length() == 0,
+      std::logic_error,
+      "A material model must be defined for block: " + element_block_name);
+
+  int const  num_dims     = 3;
+  int const  num_vertices = 8;
+  int const  num_nodes    = 8;
+  auto const dl           = Teuchos::rcp(new Albany::Layouts(
+      workset_size, num_vertices, num_nodes, num_pts, num_dims));
+
+  LCM::FieldNameMap field_name_map(false);
+
+  std::string const matName = material_db->getElementBlockParam<std::string>(
+      element_block_name, "material");
+  Teuchos::ParameterList& paramList =
+      material_db->getElementBlockSublist(element_block_name, matName);
+  Teuchos::ParameterList& mpsParams =
+      paramList.sublist("Material Point Simulator");
+
+  paramList.set<Teuchos::RCP<std::map<std::string, std::string>>>(
+      "Name Map", field_name_map.getMap());
+
+  std::string const load_case =
+      mpsParams.get<std::string>("Loading Case Name", "uniaxial");
+  int const    number_steps = mpsParams.get<int>("Number of Steps", 10);
+  double const step_size    = mpsParams.get<double>("Step Size", 1.0e-2);
+  bool const   have_temperature = mpsParams.get<bool>("Use Temperature", false);
+  double const temperature      = mpsParams.get<double>("Temperature", 1.0);
+
+  if (have_temperature) paramList.set<bool>("Have Temperature", true);
+
+  std::vector<RealType> F_vector(9, 0.0);
+  if (load_case == "uniaxial") {
+    F_vector[0] = 1.0 + number_steps * step_size;
+    F_vector[4] = 1.0;
+    F_vector[8] = 1.0;
+  } else if (load_case == "simple-shear") {
+    F_vector[0] = 1.0;
+    F_vector[1] = number_steps * step_size;
+    F_vector[4] = 1.0;
+    F_vector[8] = 1.0;
+  } else if (load_case == "hydrostatic") {
+    F_vector[0] = 1.0 + number_steps * step_size;
+    F_vector[4] = 1.0 + number_steps * step_size;
+    F_vector[8] = 1.0 + number_steps * step_size;
+  } else if (load_case == "general") {
+    F_vector =
+        mpsParams.get<Teuchos::Array<double>>("Deformation Gradient Components")
+            .toVector();
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true,
+        std::runtime_error,
+        "Improper Loading Case in Material Point Simulator block");
+  }
+
+  minitensor::Tensor<RealType> const F(3, &F_vector[0]);
+
+  //
+  // Register the state variables of the model, the same for all
+  // evaluation types, and create a discretization to hold them
+  //
+  Albany::StateManager stateMgr;
+  {
+    Teuchos::ParameterList cmiPL;
+    cmiPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
+    if (have_temperature) {
+      cmiPL.set<std::string>("Temperature Name", "Temperature");
+    }
+    LCM::ConstitutiveModelInterface<Residual, Traits> CMI(cmiPL, dl);
+    for (int sv(0); sv < CMI.getNumStateVars(); ++sv) {
+      CMI.fillStateVariableStruct(sv);
+      stateMgr.registerStateVariable(
+          CMI.getName(),
+          CMI.getLayout(),
+          dl->dummy,
+          element_block_name,
+          CMI.getInitType(),
+          CMI.getInitValue(),
+          CMI.getStateFlag(),
+          false);
+    }
+  }
+  stateMgr.registerStateVariable(
+      "F",
+      dl->qp_tensor,
+      dl->dummy,
+      element_block_name,
+      "identity",
+      1.0,
+      true,
+      false);
+
+  auto discretizationParameterList =
+      Teuchos::rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+  discretizationParameterList->set<int>("Workset Size", workset_size);
+
+  int const                                        numberOfEquations = 3;
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+
+  Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct =
+      Teuchos::rcp(new Albany::TmplSTKMeshStruct<3>(
+          discretizationParameterList, Teuchos::null, commT));
+  stkMeshStruct->setFieldAndBulkData(
+      commT,
+      discretizationParameterList,
+      numberOfEquations,
+      req,
+      stateMgr.getStateInfoStruct(),
+      stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization =
+      Teuchos::rcp(new Albany::STKDiscretization(
+          discretizationParameterList, stkMeshStruct, commT));
+
+  stateMgr.setupStateArrays(discretization);
+
+  PHAL::Workset workset;
+  workset.numCells     = workset_size;
+  workset.wsIndex      = 0;
+  workset.current_time = 0.0;
+  workset.stateArrayPtr =
+      &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  std::size_t const points_per_evaluation = workset_size * num_pts;
+  std::size_t const num_evaluations       = std::max<std::size_t>(
+      1, static_cast<std::size_t>(mpoints * 1.0e6) / points_per_evaluation);
+
+  std::cout << "Model " << material_model_name << ": " << num_evaluations
+            << " evaluations of " << workset_size << " cells x " << num_pts
+            << " points" << std::endl;
+
+  report(
+      "Residual",
+      benchmark<Residual>(
+          paramList,
+          dl,
+          workset,
+          F,
+          step_size,
+          temperature,
+          have_temperature,
+          0,
+          num_evaluations));
+
+  for (int const num_derivs : deriv_lengths) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        num_derivs < 1,
+        std::logic_error,
+        "Derivative lengths must be positive");
+    report(
+        "Jacobian<" + std::to_string(num_derivs) + ">",
+        benchmark<Jacobian>(
+            paramList,
+            dl,
+            workset,
+            F,
+            step_size,
+            temperature,
+            have_temperature,
+            num_derivs,
+            num_evaluations));
+  }
+
+  return 0;
+}
@@ -0,0 +1,226 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "BoxGrid.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace LCM {
+
+//
+//
+//
+BoxGrid::
+BoxGrid(
+    int const dimension,
+    std::vector<double> const & lo,
+    std::vector<double> const & hi) :
+    dimension_(dimension),
+    number_boxes_(dimension > 0 ? lo.size() / dimension : 0),
+    lo_(lo),
+    hi_(hi),
+    origin_(dimension, std::numeric_limits<double>::max()),
+    bin_size_(dimension, 1.0),
+    number_bins_(dimension, 1)
+{
+  assert(lo.size() == hi.size());
+
+  std::vector<double>
+  top(dimension_, std::numeric_limits<double>::lowest());
+
+  for (auto box = 0; box < number_boxes_; ++box) {
+    for (auto i = 0; i < dimension_; ++i) {
+      origin_[i] = std::min(origin_[i], lo_[dimension_ * box + i]);
+      top[i] = std::max(top[i], hi_[dimension_ * box + i]);
+    }
+  }
+
+  if (number_boxes_ == 0) {
+    bin_offsets_.assign(2, 0);
+    return;
+  }
+
+  // About one box per bin: the bin count along each direction is
+  // proportional to the extent of the grid in that direction.
+  double
+  volume = 1.0;
+
+  double
+  max_extent = 0.0;
+
+  for (auto i = 0; i < dimension_; ++i) {
+    max_extent = std::max(max_extent, top[i] - origin_[i]);
+  }
+
+  double const
+  min_extent = 1.0e-12 * std::max(max_extent, 1.0);
+
+  for (auto i = 0; i < dimension_; ++i) {
+    volume *= std::max(top[i] - origin_[i], min_extent);
+  }
+
+  double const
+  cell_size = std::pow(volume / number_boxes_, 1.0 / dimension_);
+
+  int const
+  max_bins_per_direction = 1024;
+
+  int
+  number_bins = 1;
+
+  for (auto i = 0; i < dimension_; ++i) {
+    double const
+    extent = std::max(top[i] - origin_[i], min_extent);
+
+    number_bins_[i] = std::max(1, std::min(max_bins_per_direction,
+        static_cast<int>(std::ceil(extent / cell_size))));
+
+    bin_size_[i] = extent / number_bins_[i];
+    number_bins *= number_bins_[i];
+  }
+
+  // Two passes over the boxes: count the boxes of each bin, then fill.
+  bin_offsets_.assign(number_bins + 1, 0);
+
+  std::vector<int>
+  first(dimension_), last(dimension_), bin(dimension_);
+
+  auto
+  box_range = [&](int const box) {
+    for (auto i = 0; i < dimension_; ++i) {
+      auto const
+      l = (lo_[dimension_ * box + i] - origin_[i]) / bin_size_[i];
+
+      auto const
+      h = (hi_[dimension_ * box + i] - origin_[i]) / bin_size_[i];
+
+      first[i] = std::max(0, std::min(number_bins_[i] - 1,
+          static_cast<int>(std::floor(l))));
+      last[i] = std::max(0, std::min(number_bins_[i] - 1,
+          static_cast<int>(std::floor(h))));
+    }
+  };
+
+  auto
+  for_each_bin = [&](int const box, bool const fill) {
+    box_range(box);
+    bin = first;
+    while (true) {
+      int
+      index = 0;
+
+      for (auto i = dimension_ - 1; i >= 0; --i) {
+        index = index * number_bins_[i] + bin[i];
+      }
+
+      if (fill == true) {
+        box_ids_[bin_offsets_[index]++] = box;
+      } else {
+        ++bin_offsets_[index + 1];
+      }
+
+      auto
+      i = 0;
+
+      for (; i < dimension_; ++i) {
+        if (bin[i] < last[i]) {
+          ++bin[i];
+          break;
+        }
+        bin[i] = first[i];
+      }
+
+      if (i == dimension_) break;
+    }
+  };
+
+  for (auto box = 0; box < number_boxes_; ++box) {
+    for_each_bin(box, false);
+  }
+
+  for (auto b = 0; b < number_bins; ++b) {
+    bin_offsets_[b + 1] += bin_offsets_[b];
+  }
+
+  box_ids_.resize(bin_offsets_[number_bins]);
+
+  // Filling advances each offset to the start of the next bin, so shift
+  // them back afterwards.
+  for (auto box = 0; box < number_boxes_; ++box) {
+    for_each_bin(box, true);
+  }
+
+  for (auto b = number_bins; b > 0; --b) {
+    bin_offsets_[b] = bin_offsets_[b - 1];
+  }
+  bin_offsets_[0] = 0;
+}
+
+//
+//
+//
+bool
+BoxGrid::
+getBin(double const * point, std::vector<int> & bin) const
+{
+  bin.resize(dimension_);
+
+  for (auto i = 0; i < dimension_; ++i) {
+    auto const
+    x = (point[i] - origin_[i]) / bin_size_[i];
+
+    if (x < 0.0 || x > number_bins_[i]) return false;
+
+    bin[i] = std::min(number_bins_[i] - 1, static_cast<int>(x));
+  }
+
+  return true;
+}
+
+//
+//
+//
+void
+BoxGrid::
+getCandidates(double const * point, std::vector<int> & boxes) const
+{
+  boxes.clear();
+
+  std::vector<int>
+  bin;
+
+  if (number_boxes_ == 0 || getBin(point, bin) == false) return;
+
+  int
+  index = 0;
+
+  for (auto i = dimension_ - 1; i >= 0; --i) {
+    index = index * number_bins_[i] + bin[i];
+  }
+
+  for (auto k = bin_offsets_[index]; k < bin_offsets_[index + 1]; ++k) {
+    auto const
+    box = box_ids_[k];
+
+    bool
+    inside = true;
+
+    for (auto i = 0; i < dimension_; ++i) {
+      double const
+      x = point[i];
+
+      inside = inside &&
+          lo_[dimension_ * box + i] <= x && x <= hi_[dimension_ * box + i];
+    }
+
+    if (inside == true) boxes.push_back(box);
+  }
+}
+
+} // namespace LCM
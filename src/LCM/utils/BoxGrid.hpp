@@ -0,0 +1,79 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_BoxGrid_hpp)
+#define LCM_BoxGrid_hpp
+
+#include <vector>
+
+namespace LCM {
+
+//
+// Uniform grid of bins over a set of axis-aligned boxes, usually the
+// bounding boxes of the elements of a mesh. Each box is registered in
+// every bin that it overlaps, so the boxes that may contain a point are
+// found by looking at a single bin. Used for point location.
+//
+class BoxGrid
+{
+public:
+  // Constructor. lo and hi hold the corners of the boxes, stored as
+  // lo[dimension * box + i].
+  BoxGrid(
+      int const dimension,
+      std::vector<double> const & lo,
+      std::vector<double> const & hi);
+
+  // Number of boxes
+  int
+  getNumberBoxes() const
+  {
+    return number_boxes_;
+  }
+
+  // Boxes that contain the point, in the order in which they were given.
+  void
+  getCandidates(double const * point, std::vector<int> & boxes) const;
+
+private:
+
+  // Bin of the point along each direction, false if outside the grid
+  bool
+  getBin(double const * point, std::vector<int> & bin) const;
+
+  int
+  dimension_{0};
+
+  int
+  number_boxes_{0};
+
+  std::vector<double>
+  lo_;
+
+  std::vector<double>
+  hi_;
+
+  // Grid bounds and bin sizes
+  std::vector<double>
+  origin_;
+
+  std::vector<double>
+  bin_size_;
+
+  std::vector<int>
+  number_bins_;
+
+  // Boxes of bin b are box_ids_[bin_offsets_[b], bin_offsets_[b + 1])
+  std::vector<int>
+  bin_offsets_;
+
+  std::vector<int>
+  box_ids_;
+};
+
+} // namespace LCM
+
+#endif // LCM_BoxGrid_hpp
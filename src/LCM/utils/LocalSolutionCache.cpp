@@ -0,0 +1,122 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "LocalSolutionCache.hpp"
+#include "utility/CounterMonitor.hpp"
+#include "utility/PerformanceContext.hpp"
+
+#include <algorithm>
+
+namespace LCM {
+
+//
+//
+//
+LocalSolutionCache::
+LocalSolutionCache(
+    std::string const & name,
+    int const number_unknowns,
+    bool const warm_start) :
+    name_(name),
+    number_unknowns_(number_unknowns),
+    warm_start_(warm_start)
+{
+}
+
+//
+//
+//
+void
+LocalSolutionCache::
+setWorkset(
+    int const workset,
+    int const number_cells,
+    int const number_points,
+    double const time)
+{
+  if (warm_start_ == false) return;
+
+  // New load step or step cut: the stored unknowns are stale.
+  if (time != time_ || number_points != number_points_) {
+    worksets_.clear();
+    time_ = time;
+    number_points_ = number_points;
+  }
+
+  Entry &
+  entry = worksets_[workset];
+
+  std::size_t const
+  number_entries = number_cells * number_points;
+
+  // The workset changed, e.g. after remeshing.
+  if (entry.stored.size() != number_entries) {
+    entry.values.assign(number_entries * number_unknowns_, 0.0);
+    entry.stored.assign(number_entries, 0);
+  }
+
+  current_ = &entry;
+}
+
+//
+//
+//
+bool
+LocalSolutionCache::
+get(int const cell, int const point, double * x)
+{
+  if (current_ == nullptr) return false;
+
+  std::size_t const
+  index = cell * number_points_ + point;
+
+  if (current_->stored[index] == 0) return false;
+
+  double const *
+  values = &current_->values[index * number_unknowns_];
+
+  std::copy(values, values + number_unknowns_, x);
+  number_warm_starts_ += 1;
+  return true;
+}
+
+//
+//
+//
+void
+LocalSolutionCache::
+put(int const cell, int const point, double const * x)
+{
+  if (current_ == nullptr) return;
+
+  std::size_t const
+  index = cell * number_points_ + point;
+
+  std::copy(x, x + number_unknowns_, &current_->values[index * number_unknowns_]);
+  current_->stored[index] = 1;
+}
+
+//
+//
+//
+void
+LocalSolutionCache::
+flushStatistics()
+{
+  if (number_solves_ == 0) return;
+
+  util::CounterMonitor &
+  cmonitor = util::PerformanceContext::instance().counterMonitor();
+
+  *cmonitor[name_ + ": Local Solves"] += number_solves_.exchange(0);
+  *cmonitor[name_ + ": Local Iterations"] += number_iterations_.exchange(0);
+
+  if (warm_start_ == true) {
+    *cmonitor[name_ + ": Warm Starts"] += number_warm_starts_.exchange(0);
+  }
+}
+
+} // namespace LCM
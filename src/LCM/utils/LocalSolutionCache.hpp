@@ -0,0 +1,121 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_LocalSolutionCache_hpp)
+#define LCM_LocalSolutionCache_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace LCM {
+
+//
+// Warm-start store for the local nonlinear solves of a constitutive
+// model. Keeps the last converged local unknowns of every integration
+// point of every workset, so that the next global Newton iteration of
+// the same load step can start the local solve from them instead of
+// from a fixed guess. Nothing here is committed state: the store is
+// discarded as soon as the time of the evaluation changes, that is, at
+// a new load step or after a step cut.
+//
+// It also counts local solves and iterations. The counts are added to
+// util::PerformanceContext::instance().counterMonitor() under
+// "<name>: Local Solves", "<name>: Local Iterations" and
+// "<name>: Warm Starts" by flushStatistics().
+//
+// Different cells and points may be read and written concurrently.
+//
+class LocalSolutionCache
+{
+public:
+  // Constructor. If warm_start is false only the statistics are kept.
+  LocalSolutionCache(
+      std::string const & name,
+      int const number_unknowns,
+      bool const warm_start);
+
+  bool
+  isWarmStart() const
+  {
+    return warm_start_;
+  }
+
+  // Select the workset whose points are read and written next.
+  void
+  setWorkset(
+      int const workset,
+      int const number_cells,
+      int const number_points,
+      double const time);
+
+  // Copy the stored unknowns of the point into x, false if none.
+  bool
+  get(int const cell, int const point, double * x);
+
+  // Store the converged unknowns of the point.
+  void
+  put(int const cell, int const point, double const * x);
+
+  // Record one local solve that took the given number of iterations.
+  void
+  addSolve(int const iterations)
+  {
+    number_solves_ += 1;
+    number_iterations_ += iterations;
+  }
+
+  // Add the statistics gathered since the last call to the counters.
+  void
+  flushStatistics();
+
+private:
+
+  struct Entry
+  {
+    std::vector<double>
+    values;
+
+    std::vector<char>
+    stored;
+  };
+
+  std::string
+  name_;
+
+  int
+  number_unknowns_{0};
+
+  bool
+  warm_start_{false};
+
+  double
+  time_{0.0};
+
+  int
+  number_points_{0};
+
+  std::map<int, Entry>
+  worksets_;
+
+  Entry *
+  current_{nullptr};
+
+  std::atomic<std::size_t>
+  number_solves_{0};
+
+  std::atomic<std::size_t>
+  number_iterations_{0};
+
+  std::atomic<std::size_t>
+  number_warm_starts_{0};
+};
+
+} // namespace LCM
+
+#endif // LCM_LocalSolutionCache_hpp
@@ -21,6 +21,8 @@
 #include "MOR_RythmosFullStateReconstructor.hpp"
 #include "MOR_GeneralizedCoordinatesRythmosObserver.hpp"
 
+#include "MOR_TpetraSnapshotCollectionObserver.hpp"
+
 #include "Rythmos_CompositeIntegrationObserver.hpp"
 
 #include "Teuchos_ParameterList.hpp"
@@ -53,6 +55,11 @@ RCP<ParameterList> fillDefaultSnapshotOutputParams(const RCP<ParameterList> &par
   return fillDefaultOutputParams(params, "snapshots");
 }
 
+RCP<ParameterList> fillDefaultBasisOutputParams(const RCP<ParameterList> &params)
+{
+  return fillDefaultOutputParams(params, "basis");
+}
+
 RCP<MultiVectorOutputFile> createOutputFile(const RCP<ParameterList> &params)
 {
   MultiVectorOutputFileFactory factory(params);
@@ -69,11 +76,31 @@ RCP<MultiVectorOutputFile> createSnapshotOutputFile(const RCP<ParameterList> &pa
   return createOutputFile(fillDefaultSnapshotOutputParams(params));
 }
 
+RCP<MultiVectorOutputFile> createBasisOutputFile(const RCP<ParameterList> &params)
+{
+  return createOutputFile(fillDefaultBasisOutputParams(params));
+}
+
 int getSnapshotPeriod(const RCP<ParameterList> &params)
 {
   return params->get("Period", 1);
 }
 
+int getStreamingBasisSize(const RCP<ParameterList> &params)
+{
+  return params->get("Basis Size", 32);
+}
+
+double getStreamingDiscardedEnergyFraction(const RCP<ParameterList> &params)
+{
+  return params->get("Discarded Energy Fraction", 0.0);
+}
+
+int getStreamingBlockSize(const RCP<ParameterList> &params)
+{
+  return params->get("Block Size", 8);
+}
+
 std::string getGeneralizedCoordinatesFilename(const RCP<ParameterList> &params)
 {
   const std::string outdir = params->get("Output Directory",".");
@@ -208,6 +235,25 @@ RCP<Rythmos::IntegrationObserverBase<double> > ObserverFactory::create(const RCP
   }
 }
 
+RCP<Piro::ObserverBase<double> > ObserverFactory::create(const RCP<Piro::ObserverBase<double> > &child)
+{
+  // With Tpetra, the snapshots go through a streaming SVD and only the
+  // truncated basis is written; the other observers are Epetra-only.
+  if (this->collectSnapshots()) {
+    const RCP<ParameterList> params = this->getSnapParameters();
+    const RCP<MultiVectorOutputFile> basisOutputFile = createBasisOutputFile(params);
+    return rcp(new TpetraSnapshotCollectionObserver(
+          getSnapshotPeriod(params),
+          getStreamingBasisSize(params),
+          getStreamingDiscardedEnergyFraction(params),
+          getStreamingBlockSize(params),
+          basisOutputFile,
+          child));
+  } else {
+    return child;
+  }
+}
+
 bool ObserverFactory::collectSnapshots() const
 {
   return getSnapParameters()->get("Activate", false);
@@ -8,6 +8,7 @@
 
 #include "NOX_Epetra_Observer.H"
 #include "Rythmos_IntegrationObserverBase.hpp"
+#include "Piro_ObserverBase.hpp"
 
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -26,6 +27,7 @@ public:
 
   Teuchos::RCP<NOX::Epetra::Observer> create(const Teuchos::RCP<NOX::Epetra::Observer> &child);
   Teuchos::RCP<Rythmos::IntegrationObserverBase<double> > create(const Teuchos::RCP<Rythmos::IntegrationObserverBase<double> > &child);
+  Teuchos::RCP<Piro::ObserverBase<double> > create(const Teuchos::RCP<Piro::ObserverBase<double> > &child);
 
 private:
   bool collectSnapshots() const;
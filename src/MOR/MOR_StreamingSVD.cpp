@@ -0,0 +1,318 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "MOR_StreamingSVD.hpp"
+
+#include "MOR_SingularValuesHelpers.hpp"
+
+#include "Teuchos_LAPACK.hpp"
+#include "Teuchos_Range1D.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace MOR {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::SerialDenseMatrix;
+
+namespace { // anonymous
+
+typedef SerialDenseMatrix<int, double> DenseMatrix;
+
+// Relative accuracy of the directions recovered from Gram matrices
+const double GRAM_TOLERANCE = 1.0e-8;
+
+RCP<const Tpetra_Map> localMap(int size, const RCP<const Teuchos_Comm> &comm)
+{
+  return rcp(new Tpetra_Map(size, 0, comm, Tpetra::LocallyReplicated));
+}
+
+// A^T * B, replicated on all processes
+DenseMatrix innerProducts(const Tpetra_MultiVector &A, const Tpetra_MultiVector &B)
+{
+  const int rows = A.getNumVectors();
+  const int cols = B.getNumVectors();
+  Tpetra_MultiVector result(localMap(rows, A.getMap()->getComm()), cols);
+  result.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, 1.0, A, B, 0.0);
+
+  DenseMatrix dense(rows, cols);
+  result.get1dCopy(Teuchos::ArrayView<double>(dense.values(), rows * cols), rows);
+  return dense;
+}
+
+// Y = beta * Y + alpha * A * D
+void multiplyDense(
+    double alpha, const Tpetra_MultiVector &A, const DenseMatrix &D,
+    double beta, Tpetra_MultiVector &Y)
+{
+  const Tpetra_MultiVector Dmv(
+      localMap(D.numRows(), A.getMap()->getComm()),
+      Teuchos::ArrayView<const double>(D.values(), D.stride() * (D.numCols() - 1) + D.numRows()),
+      D.stride(), D.numCols());
+  Y.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, alpha, A, Dmv, beta);
+}
+
+} // anonymous namespace
+
+StreamingSVD::StreamingSVD(
+    const RCP<const Tpetra_Map> &map,
+    int maxRank,
+    double discardedEnergyFraction,
+    int blockSize) :
+  map_(map),
+  maxRank_(maxRank),
+  discardedEnergyFraction_(discardedEnergyFraction),
+  blockSize_(blockSize),
+  bufferCount_(0),
+  snapshotCount_(0)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      maxRank <= 0,
+      std::out_of_range,
+      "maxRank = " << maxRank << ", should have maxRank > 0");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      blockSize <= 0,
+      std::out_of_range,
+      "blockSize = " << blockSize << ", should have blockSize > 0");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      discardedEnergyFraction < 0.0 || discardedEnergyFraction >= 1.0,
+      std::out_of_range,
+      "discardedEnergyFraction = " << discardedEnergyFraction << ", should be in [0, 1)");
+
+  buffer_ = rcp(new Tpetra_MultiVector(map_, blockSize_, false));
+}
+
+void StreamingSVD::addVector(const Tpetra_Vector &value)
+{
+  buffer_->getVectorNonConst(bufferCount_)->assign(value);
+  ++bufferCount_;
+  ++snapshotCount_;
+
+  if (bufferCount_ == blockSize_)
+  {
+    this->update();
+  }
+}
+
+RCP<const Tpetra_MultiVector> StreamingSVD::basis()
+{
+  this->update();
+  return basis_;
+}
+
+Teuchos::ArrayView<const double> StreamingSVD::singularValues()
+{
+  this->update();
+  return Teuchos::arrayViewFromVector(singularValues_);
+}
+
+void StreamingSVD::update()
+{
+  if (bufferCount_ == 0)
+  {
+    return;
+  }
+
+  const int rank = singularValues_.size();
+  const int count = bufferCount_;
+  bufferCount_ = 0;
+
+  // Residual of the new snapshots, projected out of the current basis twice
+  // so that it stays orthogonal to the basis to working precision
+  const RCP<Tpetra_MultiVector> residual = buffer_->subCopy(Teuchos::Range1D(0, count - 1));
+
+  std::vector<double> norms(count);
+  residual->norm2(Teuchos::arrayViewFromVector(norms));
+  double scale = *std::max_element(norms.begin(), norms.end());
+  if (rank > 0)
+  {
+    scale = std::max(scale, singularValues_.front());
+  }
+  if (scale == 0.0)
+  {
+    return;
+  }
+
+  DenseMatrix coefficients(rank, count);
+  if (rank > 0)
+  {
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      const DenseMatrix correction = innerProducts(*basis_, *residual);
+      multiplyDense(-1.0, *basis_, correction, 1.0, *residual);
+      coefficients += correction;
+    }
+  }
+
+  DenseMatrix triangle;
+  const RCP<const Tpetra_MultiVector> directions = this->orthonormalize(*residual, GRAM_TOLERANCE * scale, triangle);
+  const int newDirections = triangle.numRows();
+
+  // The snapshot matrix is now [basis, directions] * K * [W^T 0; 0 I] with
+  // K = [diag(sigma) coefficients; 0 triangle], whose SVD updates the basis
+  const int m = rank + newDirections;
+  const int n = rank + count;
+  DenseMatrix K(m, n);
+  for (int i = 0; i < rank; ++i)
+  {
+    K(i, i) = singularValues_[i];
+    for (int j = 0; j < count; ++j)
+    {
+      K(i, rank + j) = coefficients(i, j);
+    }
+  }
+  for (int i = 0; i < newDirections; ++i)
+  {
+    for (int j = 0; j < count; ++j)
+    {
+      K(rank + i, rank + j) = triangle(i, j);
+    }
+  }
+
+  const int minDim = std::min(m, n);
+  std::vector<double> sigma(minDim);
+  DenseMatrix leftVectors(m, minDim);
+  {
+    const Teuchos::LAPACK<int, double> lapack;
+    double dummyVT = 0.0;
+    double workSize = 0.0;
+    int info = 0;
+    lapack.GESVD('S', 'N', m, n, K.values(), K.stride(), &sigma[0],
+        leftVectors.values(), leftVectors.stride(), &dummyVT, 1,
+        &workSize, -1, NULL, &info);
+    std::vector<double> work(std::max(1, static_cast<int>(workSize)));
+    lapack.GESVD('S', 'N', m, n, K.values(), K.stride(), &sigma[0],
+        leftVectors.values(), leftVectors.stride(), &dummyVT, 1,
+        &work[0], work.size(), NULL, &info);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        info != 0,
+        std::runtime_error,
+        "GESVD failed with info = " << info);
+  }
+
+  const int newRank = this->truncatedRank(sigma);
+  RCP<Tpetra_MultiVector> newBasis;
+  if (newRank > 0)
+  {
+    newBasis = rcp(new Tpetra_MultiVector(map_, newRank, false));
+    if (rank > 0)
+    {
+      const DenseMatrix top(Teuchos::View, leftVectors, rank, newRank, 0, 0);
+      multiplyDense(1.0, *basis_, top, 0.0, *newBasis);
+    }
+    if (newDirections > 0)
+    {
+      const DenseMatrix bottom(Teuchos::View, leftVectors, newDirections, newRank, rank, 0);
+      multiplyDense(1.0, *directions, bottom, rank > 0 ? 1.0 : 0.0, *newBasis);
+    }
+  }
+
+  basis_ = newBasis;
+  singularValues_.assign(sigma.begin(), sigma.begin() + newRank);
+}
+
+RCP<const Tpetra_MultiVector> StreamingSVD::orthonormalize(
+    const Tpetra_MultiVector &R,
+    double tolerance,
+    DenseMatrix &T) const
+{
+  // Two passes of the Gram matrix eigendecomposition: R = Q1 * T1, then
+  // Q1 = Q * T2, so that T = T2 * T1 and Q is orthonormal to working precision
+  RCP<const Tpetra_MultiVector> Q = Teuchos::rcpFromRef(R);
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    const int cols = Q->getNumVectors();
+    DenseMatrix gram = innerProducts(*Q, *Q);
+
+    std::vector<double> eigenvalues(cols);
+    {
+      const Teuchos::LAPACK<int, double> lapack;
+      std::vector<double> work(std::max(1, 3 * cols - 1));
+      int info = 0;
+      lapack.SYEV('V', 'U', cols, gram.values(), gram.stride(), &eigenvalues[0],
+          &work[0], work.size(), &info);
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          info != 0,
+          std::runtime_error,
+          "SYEV failed with info = " << info);
+    }
+
+    // Eigenvalues are in ascending order; keep those above tolerance^2
+    std::vector<int> kept;
+    for (int j = cols - 1; j >= 0; --j)
+    {
+      if (eigenvalues[j] > tolerance * tolerance)
+      {
+        kept.push_back(j);
+      }
+    }
+    const int rank = kept.size();
+
+    DenseMatrix normalizer(cols, rank);
+    DenseMatrix passT(rank, cols);
+    for (int k = 0; k < rank; ++k)
+    {
+      const double s = std::sqrt(eigenvalues[kept[k]]);
+      for (int i = 0; i < cols; ++i)
+      {
+        normalizer(i, k) = gram(i, kept[k]) / s;
+        passT(k, i) = gram(i, kept[k]) * s;
+      }
+    }
+
+    if (pass == 0)
+    {
+      T = passT;
+    }
+    else
+    {
+      DenseMatrix product(rank, T.numCols());
+      product.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, passT, T, 0.0);
+      T = product;
+    }
+
+    if (rank == 0)
+    {
+      return Teuchos::null;
+    }
+    const RCP<Tpetra_MultiVector> next = rcp(new Tpetra_MultiVector(map_, rank, false));
+    multiplyDense(1.0, *Q, normalizer, 0.0, *next);
+    Q = next;
+
+    // The second pass only corrects the loss of orthogonality
+    tolerance = 0.5;
+  }
+  return Q;
+}
+
+int StreamingSVD::truncatedRank(const std::vector<double> &singularValues) const
+{
+  int result = std::min<int>(maxRank_, singularValues.size());
+  while (result > 0 && singularValues[result - 1] == 0.0)
+  {
+    --result;
+  }
+
+  if (discardedEnergyFraction_ > 0.0 && result > 0)
+  {
+    const Teuchos::Array<double> fractions =
+      computeDiscardedEnergyFractions(Teuchos::arrayViewFromVector(singularValues));
+    for (int i = 0; i < result; ++i)
+    {
+      if (fractions[i] <= discardedEnergyFraction_)
+      {
+        result = i + 1;
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+} // namespace MOR
@@ -0,0 +1,76 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#ifndef MOR_STREAMINGSVD_HPP
+#define MOR_STREAMINGSVD_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ArrayView.hpp"
+#include "Teuchos_SerialDenseMatrix.hpp"
+
+#include <vector>
+
+namespace MOR {
+
+// Left singular vectors of a snapshot matrix whose columns arrive one at a
+// time, updated incrementally (block version of Brand's incremental SVD).
+// Snapshots are buffered by blocks of blockSize and folded into the basis
+// when the buffer is full. After each update, the basis is truncated to at
+// most maxRank vectors and to the fewest vectors whose discarded energy
+// fraction (see computeDiscardedEnergyFractions) does not exceed
+// discardedEnergyFraction. Memory stays O(maxRank + blockSize) vectors,
+// whatever the number of snapshots.
+class StreamingSVD {
+public:
+  StreamingSVD(
+      const Teuchos::RCP<const Tpetra_Map> &map,
+      int maxRank,
+      double discardedEnergyFraction,
+      int blockSize);
+
+  void addVector(const Tpetra_Vector &value);
+
+  // Fold the buffered snapshots into the basis
+  void update();
+
+  int snapshotCount() const { return snapshotCount_; }
+
+  // Up to date with all the snapshots added so far; null until a nonzero
+  // snapshot has been added
+  Teuchos::RCP<const Tpetra_MultiVector> basis();
+  Teuchos::ArrayView<const double> singularValues();
+
+private:
+  // Orthonormalize the columns of R, so that R = Q * T, dropping the
+  // directions with singular values below tolerance
+  Teuchos::RCP<const Tpetra_MultiVector> orthonormalize(
+      const Tpetra_MultiVector &R,
+      double tolerance,
+      Teuchos::SerialDenseMatrix<int, double> &T) const;
+
+  int truncatedRank(const std::vector<double> &singularValues) const;
+
+  Teuchos::RCP<const Tpetra_Map> map_;
+  int maxRank_;
+  double discardedEnergyFraction_;
+  int blockSize_;
+
+  Teuchos::RCP<Tpetra_MultiVector> basis_;
+  std::vector<double> singularValues_;
+
+  Teuchos::RCP<Tpetra_MultiVector> buffer_;
+  int bufferCount_;
+  int snapshotCount_;
+
+  // Disallow copy and assignment
+  StreamingSVD(const StreamingSVD &);
+  StreamingSVD &operator=(const StreamingSVD &);
+};
+
+} // namespace MOR
+
+#endif /* MOR_STREAMINGSVD_HPP */
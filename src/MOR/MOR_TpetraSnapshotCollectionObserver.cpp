@@ -0,0 +1,128 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "MOR_TpetraSnapshotCollectionObserver.hpp"
+
+#include "MOR_MultiVectorOutputFile.hpp"
+
+#include "Albany_Utils.hpp"
+#include "Petra_Converters.hpp"
+
+#include "Epetra_MultiVector.h"
+
+#include "Teuchos_TestForException.hpp"
+
+#include <stdexcept>
+
+namespace MOR {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+TpetraSnapshotCollectionObserver::TpetraSnapshotCollectionObserver(
+    int period,
+    int maxRank,
+    double discardedEnergyFraction,
+    int blockSize,
+    const RCP<MultiVectorOutputFile> &basisFile,
+    const RCP<Piro::ObserverBase<double> > &decoratedObserver) :
+  period_(period),
+  maxRank_(maxRank),
+  discardedEnergyFraction_(discardedEnergyFraction),
+  blockSize_(blockSize),
+  basisFile_(basisFile),
+  decoratedObserver_(decoratedObserver),
+  skipCount_(0)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      period <= 0,
+      std::out_of_range,
+      "period = " << period << ", should have period > 0");
+}
+
+void TpetraSnapshotCollectionObserver::finalize()
+{
+  if (Teuchos::is_null(svd_))
+  {
+    return;
+  }
+
+  const RCP<const Tpetra_MultiVector> basis = svd_->basis();
+  if (Teuchos::nonnull(basis))
+  {
+    // The output files take Epetra multivectors
+    const RCP<const Teuchos_Comm> commT = basis->getMap()->getComm();
+    const RCP<const Epetra_Comm> comm = Albany::createEpetraCommFromTeuchosComm(commT);
+    const RCP<const Epetra_Map> map = Petra::TpetraMap_To_EpetraMap(basis->getMap(), comm);
+    Epetra_MultiVector basisE(*map, basis->getNumVectors(), false);
+    Petra::TpetraMultiVector_To_EpetraMultiVector(basis, basisE, comm);
+
+    basisFile_->write(basisE);
+  }
+}
+
+void TpetraSnapshotCollectionObserver::observeSolution(
+    const Thyra::VectorBase<double> &solution)
+{
+  decoratedObserver_->observeSolution(solution);
+  this->addVector(*ConverterT::getConstTpetraVector(Teuchos::rcpFromRef(solution)));
+}
+
+void TpetraSnapshotCollectionObserver::observeSolution(
+    const Thyra::VectorBase<double> &solution,
+    const double stamp)
+{
+  decoratedObserver_->observeSolution(solution, stamp);
+  this->addVector(*ConverterT::getConstTpetraVector(Teuchos::rcpFromRef(solution)));
+}
+
+void TpetraSnapshotCollectionObserver::observeSolution(
+    const Thyra::VectorBase<double> &solution,
+    const Thyra::VectorBase<double> &solution_dot,
+    const double stamp)
+{
+  decoratedObserver_->observeSolution(solution, solution_dot, stamp);
+  this->addVector(*ConverterT::getConstTpetraVector(Teuchos::rcpFromRef(solution)));
+}
+
+void TpetraSnapshotCollectionObserver::observeSolution(
+    const Thyra::VectorBase<double> &solution,
+    const Thyra::VectorBase<double> &solution_dot,
+    const Thyra::VectorBase<double> &solution_dotdot,
+    const double stamp)
+{
+  decoratedObserver_->observeSolution(solution, solution_dot, solution_dotdot, stamp);
+  this->addVector(*ConverterT::getConstTpetraVector(Teuchos::rcpFromRef(solution)));
+}
+
+void TpetraSnapshotCollectionObserver::observeSolution(
+    const Thyra::MultiVectorBase<double> &solution,
+    const double stamp)
+{
+  decoratedObserver_->observeSolution(solution, stamp);
+  // Column 0 holds the solution, the others its time derivatives
+  const RCP<const Tpetra_MultiVector> solutionT =
+    ConverterT::getConstTpetraMultiVector(Teuchos::rcpFromRef(solution));
+  this->addVector(*solutionT->getVector(0));
+}
+
+void TpetraSnapshotCollectionObserver::addVector(const Tpetra_Vector &value)
+{
+  if (skipCount_ == 0)
+  {
+    if (Teuchos::is_null(svd_))
+    {
+      svd_ = rcp(new StreamingSVD(value.getMap(), maxRank_, discardedEnergyFraction_, blockSize_));
+    }
+    svd_->addVector(value);
+    skipCount_ = period_ - 1;
+  }
+  else
+  {
+    --skipCount_;
+  }
+}
+
+} // namespace MOR
@@ -0,0 +1,80 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#ifndef MOR_TPETRASNAPSHOTCOLLECTIONOBSERVER_HPP
+#define MOR_TPETRASNAPSHOTCOLLECTIONOBSERVER_HPP
+
+#include "Piro_ObserverBase.hpp"
+
+#include "MOR_StreamingSVD.hpp"
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+
+namespace MOR {
+
+class MultiVectorOutputFile;
+
+// Unlike SnapshotCollectionObserver, the snapshots are not stored: they are
+// folded into a StreamingSVD as they come, and the resulting basis is
+// written to basisFile by finalize.
+class TpetraSnapshotCollectionObserver : public Piro::ObserverBase<double> {
+public:
+  TpetraSnapshotCollectionObserver(
+      int period,
+      int maxRank,
+      double discardedEnergyFraction,
+      int blockSize,
+      const Teuchos::RCP<MultiVectorOutputFile> &basisFile,
+      const Teuchos::RCP<Piro::ObserverBase<double> > &decoratedObserver);
+
+  //! Writes the basis of the snapshots collected so far; call when the
+  //! solve has ended
+  void finalize();
+
+  //! Calls underlying observer then collects the solution
+  virtual void observeSolution(const Thyra::VectorBase<double> &solution);
+
+  virtual void observeSolution(
+      const Thyra::VectorBase<double> &solution,
+      const double stamp);
+
+  virtual void observeSolution(
+      const Thyra::VectorBase<double> &solution,
+      const Thyra::VectorBase<double> &solution_dot,
+      const double stamp);
+
+  virtual void observeSolution(
+      const Thyra::VectorBase<double> &solution,
+      const Thyra::VectorBase<double> &solution_dot,
+      const Thyra::VectorBase<double> &solution_dotdot,
+      const double stamp);
+
+  virtual void observeSolution(
+      const Thyra::MultiVectorBase<double> &solution,
+      const double stamp);
+
+private:
+  void addVector(const Tpetra_Vector &value);
+
+  int period_;
+  int maxRank_;
+  double discardedEnergyFraction_;
+  int blockSize_;
+  Teuchos::RCP<MultiVectorOutputFile> basisFile_;
+  Teuchos::RCP<Piro::ObserverBase<double> > decoratedObserver_;
+
+  int skipCount_;
+  Teuchos::RCP<StreamingSVD> svd_;
+
+  // Disallow copy & assignment
+  TpetraSnapshotCollectionObserver(const TpetraSnapshotCollectionObserver &);
+  TpetraSnapshotCollectionObserver &operator=(const TpetraSnapshotCollectionObserver &);
+};
+
+} // namespace MOR
+
+#endif /* MOR_TPETRASNAPSHOTCOLLECTIONOBSERVER_HPP */
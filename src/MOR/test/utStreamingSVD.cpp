@@ -0,0 +1,252 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "MOR_StreamingSVD.hpp"
+#include "MOR_SingularValuesHelpers.hpp"
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_LAPACK.hpp"
+#include "Teuchos_SerialDenseMatrix.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include "Kokkos_Core.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+bool TpetraBuild = true;
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+typedef Teuchos::SerialDenseMatrix<int, double> DenseMatrix;
+
+const int numRows = 60;
+
+// Snapshot matrix of the given rank, the product of random factors of sizes
+// numRows x rank and rank x numSnapshots. Column k of the left factor is
+// scaled by decay^k. Every process generates the same matrix.
+DenseMatrix randomSnapshots(int rank, int numSnapshots, double decay, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> normal;
+
+  DenseMatrix left(numRows, rank);
+  double scale = 1.0;
+  for (int k = 0; k < rank; ++k, scale *= decay)
+  {
+    for (int i = 0; i < numRows; ++i)
+    {
+      left(i, k) = scale * normal(generator);
+    }
+  }
+
+  DenseMatrix right(rank, numSnapshots);
+  for (int j = 0; j < numSnapshots; ++j)
+  {
+    for (int k = 0; k < rank; ++k)
+    {
+      right(k, j) = normal(generator);
+    }
+  }
+
+  DenseMatrix result(numRows, numSnapshots);
+  result.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, left, right, 0.0);
+  return result;
+}
+
+// Batch SVD of all the snapshots at once
+void batchSVD(DenseMatrix A, std::vector<double> &sigma, DenseMatrix &U)
+{
+  const int m = A.numRows();
+  const int n = A.numCols();
+  const int minDim = std::min(m, n);
+  sigma.resize(minDim);
+  U.shape(m, minDim);
+
+  const Teuchos::LAPACK<int, double> lapack;
+  double dummyVT = 0.0;
+  double workSize = 0.0;
+  int info = 0;
+  lapack.GESVD('S', 'N', m, n, A.values(), A.stride(), &sigma[0],
+      U.values(), U.stride(), &dummyVT, 1, &workSize, -1, NULL, &info);
+  std::vector<double> work(std::max(1, static_cast<int>(workSize)));
+  lapack.GESVD('S', 'N', m, n, A.values(), A.stride(), &sigma[0],
+      U.values(), U.stride(), &dummyVT, 1, &work[0], work.size(), NULL, &info);
+  TEUCHOS_TEST_FOR_EXCEPTION(info != 0, std::runtime_error, "GESVD failed with info = " << info);
+}
+
+// Basis size of the batch SVD truncated as the options of the snapshot
+// collection ask: numerically zero singular values dropped, at most "Basis
+// Size" vectors, and the fewest vectors within "Discarded Energy Fraction"
+int batchRank(const std::vector<double> &sigma, int maxRank, double discardedEnergyFraction)
+{
+  int result = 0;
+  while (result < static_cast<int>(sigma.size()) && sigma[result] > 1.0e-10 * sigma.front())
+  {
+    ++result;
+  }
+  result = std::min(result, maxRank);
+
+  if (discardedEnergyFraction > 0.0 && result > 0)
+  {
+    const Teuchos::Array<double> fractions =
+      MOR::computeDiscardedEnergyFractions(Teuchos::arrayViewFromVector(sigma));
+    for (int i = 0; i < result; ++i)
+    {
+      if (fractions[i] <= discardedEnergyFraction)
+      {
+        result = i + 1;
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+// Distributed copy of the first columns of a replicated dense matrix
+RCP<Tpetra_MultiVector> distribute(const RCP<const Tpetra_Map> &map, const DenseMatrix &A, int numCols)
+{
+  const RCP<Tpetra_MultiVector> result = rcp(new Tpetra_MultiVector(map, numCols));
+  const Tpetra_LO numLocalRows = map->getNodeNumElements();
+  for (int j = 0; j < numCols; ++j)
+  {
+    for (Tpetra_LO i = 0; i < numLocalRows; ++i)
+    {
+      result->replaceLocalValue(i, j, A(map->getGlobalElement(i), j));
+    }
+  }
+  return result;
+}
+
+// Feed the snapshots to a StreamingSVD by blocks of blockSize and compare its
+// singular values and basis with the truncated batch SVD
+bool compareWithBatch(
+    const DenseMatrix &snapshots,
+    int maxRank,
+    double discardedEnergyFraction,
+    int blockSize,
+    Teuchos::FancyOStream &out)
+{
+  const RCP<const Teuchos_Comm> comm = Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+  const RCP<const Tpetra_Map> map = rcp(new Tpetra_Map(numRows, 0, comm));
+  const int numSnapshots = snapshots.numCols();
+
+  MOR::StreamingSVD svd(map, maxRank, discardedEnergyFraction, blockSize);
+  const RCP<const Tpetra_MultiVector> snapshotsT = distribute(map, snapshots, numSnapshots);
+  for (int j = 0; j < numSnapshots; ++j)
+  {
+    svd.addVector(*snapshotsT->getVector(j));
+  }
+
+  std::vector<double> sigma;
+  DenseMatrix U;
+  batchSVD(snapshots, sigma, U);
+  const int rank = batchRank(sigma, maxRank, discardedEnergyFraction);
+
+  bool success = true;
+
+  const Teuchos::ArrayView<const double> streamingSigma = svd.singularValues();
+  if (static_cast<int>(streamingSigma.size()) != rank)
+  {
+    out << streamingSigma.size() << " singular values, batch SVD keeps " << rank << '\n';
+    return false;
+  }
+
+  for (int k = 0; k < rank; ++k)
+  {
+    if (std::abs(streamingSigma[k] - sigma[k]) > 1.0e-10 * sigma.front())
+    {
+      out << "singular value " << k << ": " << streamingSigma[k] << ", batch " << sigma[k] << '\n';
+      success = false;
+    }
+  }
+
+  // Basis vectors are unique up to their sign, the singular values being
+  // distinct
+  const RCP<const Tpetra_MultiVector> basis = svd.basis();
+  const RCP<const Tpetra_MultiVector> batchBasis = distribute(map, U, rank);
+  for (int k = 0; k < rank; ++k)
+  {
+    const double cosine = basis->getVector(k)->dot(*batchBasis->getVector(k));
+    if (std::abs(std::abs(cosine) - 1.0) > 1.0e-8)
+    {
+      out << "basis vector " << k << ": cosine " << cosine << " with the batch one\n";
+      success = false;
+    }
+  }
+
+  return success;
+}
+
+TEUCHOS_UNIT_TEST(StreamingSVD, LowRankInBlocks)
+{
+  const DenseMatrix snapshots = randomSnapshots(6, 40, 0.7, 1);
+  TEST_ASSERT(compareWithBatch(snapshots, 10, 0.0, 4, out));
+}
+
+TEUCHOS_UNIT_TEST(StreamingSVD, LowRankInUnevenBlocks)
+{
+  // The last, partial block is folded in when the basis is requested
+  const DenseMatrix snapshots = randomSnapshots(6, 40, 0.7, 2);
+  TEST_ASSERT(compareWithBatch(snapshots, 10, 0.0, 7, out));
+}
+
+TEUCHOS_UNIT_TEST(StreamingSVD, RankEqualToBasisSize)
+{
+  // No direction is lost when the basis is full
+  const DenseMatrix snapshots = randomSnapshots(5, 30, 0.7, 3);
+  TEST_ASSERT(compareWithBatch(snapshots, 5, 0.0, 3, out));
+}
+
+TEUCHOS_UNIT_TEST(StreamingSVD, BasisSize)
+{
+  const DenseMatrix snapshots = randomSnapshots(12, 12, 0.7, 4);
+  TEST_ASSERT(compareWithBatch(snapshots, 4, 0.0, 12, out));
+}
+
+TEUCHOS_UNIT_TEST(StreamingSVD, DiscardedEnergyFraction)
+{
+  const DenseMatrix snapshots = randomSnapshots(10, 16, 0.3, 5);
+  TEST_ASSERT(compareWithBatch(snapshots, 16, 1.0e-2, 16, out));
+}
+
+TEUCHOS_UNIT_TEST(StreamingSVD, ZeroSnapshots)
+{
+  const RCP<const Teuchos_Comm> comm = Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+  const RCP<const Tpetra_Map> map = rcp(new Tpetra_Map(numRows, 0, comm));
+
+  MOR::StreamingSVD svd(map, 4, 0.0, 2);
+  Tpetra_Vector zero(map);
+  for (int j = 0; j < 3; ++j)
+  {
+    svd.addVector(zero);
+  }
+
+  TEST_EQUALITY(svd.snapshotCount(), 3);
+  TEST_ASSERT(Teuchos::is_null(svd.basis()));
+  TEST_EQUALITY(svd.singularValues().size(), 0);
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+
+  const int result = Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+
+  Kokkos::finalize();
+  return result;
+}
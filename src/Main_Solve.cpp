@@ -18,6 +18,7 @@
 #include "Teuchos_GlobalMPISession.hpp"
 #include "Teuchos_TimeMonitor.hpp"
 #include "Teuchos_VerboseObject.hpp"
+#include "utility/PerformanceContext.hpp"
 #include "Teuchos_StandardCatchMacros.hpp"
 #include "Epetra_Map.h"  //Needed for serial, somehow
 
@@ -310,6 +311,10 @@ int main(int argc, char *argv[]) {
 
   Teuchos::TimeMonitor::summarize(*out,false,true,false/*zero timers*/);
 
+  // Per-evaluator profile, if the problem set "Profile Evaluators"
+  util::PerformanceContext::instance().evaluatorMonitor().summarize(*out);
+  util::PerformanceContext::instance().evaluatorMonitor().writeJSON();
+
   Kokkos::finalize_all();
  
   return status;
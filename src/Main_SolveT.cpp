@@ -19,6 +19,7 @@
 #include "Teuchos_StandardCatchMacros.hpp"
 #include "Teuchos_TimeMonitor.hpp"
 #include "Teuchos_VerboseObject.hpp"
+#include "utility/PerformanceContext.hpp"
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
 
@@ -328,6 +329,7 @@ main(int argc, char *argv[]) {
         thyraSensitivities;
     Piro::PerformSolve(
         *solver, solveParams, thyraResponses, thyraSensitivities);
+    slvrfctry.finalizeObserverT();
 
     Teuchos::Array<Teuchos::RCP<const Tpetra_Vector>> responses;
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Tpetra_MultiVector>>>
@@ -568,6 +570,10 @@ main(int argc, char *argv[]) {
 
   Teuchos::TimeMonitor::summarize(*out, false, true, false /*zero timers*/);
 
+  // Per-evaluator profile, if the problem set "Profile Evaluators"
+  util::PerformanceContext::instance().evaluatorMonitor().summarize(*out);
+  util::PerformanceContext::instance().evaluatorMonitor().writeJSON();
+
 #ifdef ALBANY_APF
   Albany::APFMeshStruct::finalize_libraries();
 #endif
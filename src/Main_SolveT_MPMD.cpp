@@ -378,6 +378,7 @@ MPMD_App::compute(const std::string & noOp)
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Thyra::MultiVectorBase<ST>>>> thyraSensitivities;
 
     Piro::PerformSolve(*m_solver, solveParams, thyraResponses, thyraSensitivities);
+    m_solverFactory->finalizeObserverT();
 
     tpetraFromThyra(thyraResponses, thyraSensitivities, m_responses, m_sensitivities);
 
@@ -316,6 +316,7 @@ int main(int argc, char *argv[]) {
         integrator->initialize(); 
       }
       bool integratorStatus = integrator->advanceTime(); 
+      slvrfctry.finalizeObserverT();
       double time = integrator->getTime();
       *out << "\n Final time = " << time << "\n"; 
       Teuchos::RCP<Thyra::VectorBase<double> > x = integrator->getX();
@@ -0,0 +1,148 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_EVALUATOR_PROFILE_HPP
+#define PHAL_EVALUATOR_PROFILE_HPP
+
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Workset.hpp"
+#include "Phalanx_Evaluator.hpp"
+#include "Phalanx_TypeStrings.hpp"
+#include "utility/PerformanceContext.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <typeinfo>
+
+namespace PHAL {
+
+//! Length of the derivative array of EvalT::ScalarT on a workset
+template <typename EvalT>
+inline std::size_t profileDerivativeLength(const Workset& workset) {
+  return 0;
+}
+
+template <>
+inline std::size_t
+profileDerivativeLength<AlbanyTraits::Jacobian>(const Workset& workset) {
+  const auto& conn = workset.wsElNodeEqID;
+  return conn.size() == 0 ? 0 : conn.dimension(1) * conn.dimension(2);
+}
+
+template <>
+inline std::size_t
+profileDerivativeLength<AlbanyTraits::Tangent>(const Workset& workset) {
+  return workset.num_cols_x + workset.num_cols_p;
+}
+
+template <>
+inline std::size_t
+profileDerivativeLength<AlbanyTraits::DistParamDeriv>(const Workset& workset) {
+  const auto& conn = workset.wsElNodeEqID;
+  return conn.size() == 0 ? 0 : conn.dimension(1);
+}
+
+/*! Times one call of evaluateFields() of an evaluator and adds it to
+ *  util::PerformanceContext::instance().evaluatorMonitor(), if
+ *  workset.profile_evaluators is set. Construct it first thing in
+ *  evaluateFields():
+ *  \code
+ *    PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
+ *  \endcode
+ *  The MDField traffic is estimated from the layouts of the evaluated and
+ *  dependent fields: every entry is read or written once.
+ */
+template <typename EvalT>
+class EvaluatorProfile {
+public:
+  EvaluatorProfile(const PHX::Evaluator<AlbanyTraits>& evaluator,
+                   const Workset& workset)
+      : evaluator_(evaluator), workset_(workset),
+        active_(workset.profile_evaluators) {
+    if (active_)
+      start_ = std::chrono::steady_clock::now();
+  }
+
+  ~EvaluatorProfile() {
+    if (!active_)
+      return;
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+    Kokkos::fence();
+#endif
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_).count();
+
+    const std::size_t deriv_length = profileDerivativeLength<EvalT>(workset_);
+    const std::size_t bytes =
+        fieldBytes(evaluator_.evaluatedFields(), deriv_length) +
+        fieldBytes(evaluator_.dependentFields(), deriv_length);
+
+    util::PerformanceContext::instance().evaluatorMonitor().record(
+        PHX::typeAsString<EvalT>(), evaluator_.getName(), seconds,
+        workset_.numCells, bytes, deriv_length);
+  }
+
+private:
+  template <typename Tags>
+  static std::size_t fieldBytes(const Tags& tags,
+                                const std::size_t deriv_length) {
+    std::size_t bytes = 0;
+    for (const auto& tag : tags) {
+      // Anything that is not a plain RealType field is taken to be a FAD
+      // of the evaluation type.
+      const std::size_t entry = tag->dataTypeInfo() == typeid(RealType)
+                                    ? sizeof(RealType)
+                                    : sizeof(RealType) * (1 + deriv_length);
+      bytes += tag->dataLayout().size() * entry;
+    }
+    return bytes;
+  }
+
+  const PHX::Evaluator<AlbanyTraits>& evaluator_;
+  const Workset& workset_;
+  const bool active_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/*! Times the evaluation of all the evaluators of one workset and adds it
+ *  to the workset table of util::PerformanceContext::instance()
+ *  .evaluatorMonitor(), if workset.profile_evaluators is set. The
+ *  difference to the evaluators with an EvaluatorProfile shows up as
+ *  "(other evaluators)". Albany::Application constructs one around each
+ *  field manager evaluation.
+ */
+template <typename EvalT>
+class WorksetProfile {
+public:
+  explicit WorksetProfile(const Workset& workset)
+      : workset_(workset), active_(workset.profile_evaluators) {
+    if (active_)
+      start_ = std::chrono::steady_clock::now();
+  }
+
+  ~WorksetProfile() {
+    if (!active_)
+      return;
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+    Kokkos::fence();
+#endif
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_).count();
+
+    util::PerformanceContext::instance().evaluatorMonitor().recordWorkset(
+        PHX::typeAsString<EvalT>(), workset_.wsIndex, seconds,
+        workset_.numCells, profileDerivativeLength<EvalT>(workset_));
+  }
+
+private:
+  const Workset& workset_;
+  const bool active_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace PHAL
+
+#endif // PHAL_EVALUATOR_PROFILE_HPP
@@ -9,6 +9,21 @@
 
 namespace PHAL {
 
+namespace {
+//! An exact-size static FadType can only hold ALBANY_SFAD_SIZE derivatives.
+int checkJacobianDerivativeDimensions (const int dims)
+{
+#if defined(ALBANY_SFAD)
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    dims != ALBANY_SFAD_SIZE, std::logic_error,
+    "Error! Albany was built with SFAD_SIZE = " << ALBANY_SFAD_SIZE
+    << " but this problem needs " << dims << " derivatives per element."
+    << " Reconfigure with -D SFAD_SIZE=" << dims << " or without ENABLE_SFAD.\n");
+#endif
+  return dims;
+}
+} // namespace
+
 template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian> (
   const Albany::Application* app, const Albany::MeshSpecsStruct* ms)
 {
@@ -20,10 +35,12 @@ template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian> (
         int side_node_count = ms->ctd.side[2].topology->node_count;
         int node_count = ms->ctd.node_count;
         int numLevels = app->getDiscretization()->getLayeredMeshNumbering()->numLayers+1;
-        return app->getNumEquations()*(node_count + side_node_count*numLevels);
+        return checkJacobianDerivativeDimensions(
+          app->getNumEquations()*(node_count + side_node_count*numLevels));
       }
   }
-  return app->getNumEquations() * ms->ctd.node_count;
+  return checkJacobianDerivativeDimensions(
+    app->getNumEquations() * ms->ctd.node_count);
 }
 
 template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Tangent> (
@@ -42,13 +42,19 @@ class Application;
 } // namespace Albany
 #endif
 
+namespace Albany {
+class FrozenElements;
+} // namespace Albany
+
 
 namespace PHAL {
 
 struct Workset {
 
   Workset() :
-    transientTerms(false), accelerationTerms(false), ignore_residual(false) {}
+    transientTerms(false), accelerationTerms(false), ignore_residual(false),
+    cache_basis_functions(false), cache_jacobian_offsets(false),
+    profile_evaluators(false) {}
 
   unsigned int numCells;
   unsigned int wsIndex;
@@ -182,6 +188,27 @@ struct Workset {
   // significantly reduce Jacobian calculation cost.
   bool ignore_residual;
 
+  // Flag indicating whether evaluators may reuse basis function data
+  // computed for this workset in an earlier evaluation, as long as
+  // disc->getMeshVersion() has not changed. Only set when the mesh
+  // coordinates do not depend on the solution or on parameters.
+  bool cache_basis_functions;
+
+  // Flag indicating whether the Jacobian scatter may keep, per workset,
+  // the positions of its entries in the local matrix values, as long as
+  // disc->getMeshVersion() and disc->getGraphVersion() have not changed.
+  bool cache_jacobian_offsets;
+
+  // Flag indicating whether instrumented evaluators and the workset fill
+  // record their time and MDField traffic in util::PerformanceContext (see
+  // PHAL_EvaluatorProfile).
+  bool profile_evaluators;
+
+  // Element Jacobian cache of the "Frozen Element Jacobians" mode, null
+  // if the mode is off. Evaluators may flag cells whose state did not
+  // change, and the Jacobian scatter records element matrices into it.
+  Teuchos::RCP<Albany::FrozenElements> frozen_elements;
+
   // Flag indicated whether we are solving the adjoint operator or the
   // forward operator.  This is used in the Albany application when
   // either the Jacobian or the transpose of the Jacobian is scattered.
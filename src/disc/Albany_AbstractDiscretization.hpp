@@ -146,6 +146,17 @@ class AbstractDiscretization {
     //! Set coordinates (overlap map) for mesh adaptation.
     virtual void setCoordinates(const Teuchos::ArrayRCP<const double>& c) = 0;
 
+    //! Counter incremented whenever the mesh coordinates or connectivity
+    //! change. A negative value means the discretization does not track
+    //! mesh changes, so data computed from the mesh must not be cached.
+    virtual int getMeshVersion() const { return -1; }
+
+    //! Counter incremented whenever the Jacobian graph is rebuilt. While it
+    //! is unchanged, symbolic setup done on the Jacobian (e.g. aggregates or
+    //! an ILU pattern) remains valid. A negative value means the graph is not
+    //! tracked.
+    virtual int getGraphVersion() const { return -1; }
+
     //! The reference configuration manager handles updating the reference
     //! configuration. This is only relevant, and also only optional, in the
     //! case of mesh adaptation.
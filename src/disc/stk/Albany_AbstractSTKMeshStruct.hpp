@@ -58,10 +58,16 @@ namespace Albany {
     int numDim;
     int neq;
     bool interleavedOrdering;
+    //! Local node numbering: "None", "Reverse Cuthill-McKee" or "Hilbert"
+    std::string nodeOrdering;
 
     bool exoOutput;
     std::string exoOutFile;
     int exoOutputInterval;
+    bool exoOutputAsync;
+    //! Output fields and the staging copies that asynchronous exodus output
+    //! writes from, so that the solver may change the fields meanwhile
+    std::vector<std::pair<stk::mesh::FieldBase*, stk::mesh::FieldBase*> > exoOutputStagingFields;
     std::string cdfOutFile;
     bool cdfOutput;
     unsigned nLat;
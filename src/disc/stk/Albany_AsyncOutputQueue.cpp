@@ -0,0 +1,106 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_AsyncOutputQueue.hpp"
+
+#include "Teuchos_TestForException.hpp"
+
+namespace Albany {
+
+AsyncOutputQueue::AsyncOutputQueue(int max_pending)
+    : max_pending_(max_pending)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      max_pending_ < 1,
+      std::logic_error,
+      "Error in Albany::AsyncOutputQueue: queue depth must be >= 1, not "
+          << max_pending_ << std::endl);
+
+  writer_ = std::thread(&AsyncOutputQueue::run, this);
+}
+
+AsyncOutputQueue::~AsyncOutputQueue()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+    stop_ = true;
+  }
+  changed_.notify_all();
+  writer_.join();
+}
+
+void
+AsyncOutputQueue::push(std::function<void()> job)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this] {
+      return static_cast<int>(jobs_.size()) < max_pending_ || error_;
+    });
+    rethrowError();
+    jobs_.push_back(std::move(job));
+  }
+  changed_.notify_all();
+}
+
+void
+AsyncOutputQueue::flush()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+  rethrowError();
+}
+
+void
+AsyncOutputQueue::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    changed_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+    if (jobs_.empty()) return;
+
+    std::function<void()> job = std::move(jobs_.front());
+    jobs_.pop_front();
+    busy_ = true;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      job();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    // Release what the job captured before flush() can return, so that
+    // the submitting thread is the only owner of it again.
+    job = nullptr;
+
+    lock.lock();
+    if (error && !error_) error_ = error;
+    busy_ = false;
+    changed_.notify_all();
+  }
+}
+
+void
+AsyncOutputQueue::rethrowError()
+{
+  // Called with the mutex held
+  if (error_) {
+    std::exception_ptr error = error_;
+    error_                   = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+std::mutex&
+fileIoMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+}  // namespace Albany
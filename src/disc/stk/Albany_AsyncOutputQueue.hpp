@@ -0,0 +1,86 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_ASYNCOUTPUTQUEUE_HPP
+#define ALBANY_ASYNCOUTPUTQUEUE_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Albany {
+
+/*!
+ * \brief Runs output jobs, in submission order, on a dedicated writer
+ * thread so that the solver does not wait on file I/O.
+ *
+ * At most \c max_pending jobs may be queued; push() blocks beyond that.
+ * An exception thrown by a job is rethrown by the next push() or flush().
+ * A job, and everything it captured, is destroyed before flush() returns.
+ * The destructor flushes the queue and joins the writer thread.
+ *
+ * Jobs share RCPs with the submitting thread, so the queue must only be
+ * used with Teuchos configured with Teuchos_ENABLE_THREAD_SAFE=ON.
+ */
+class AsyncOutputQueue
+{
+ public:
+  explicit AsyncOutputQueue(int max_pending);
+
+  ~AsyncOutputQueue();
+
+  AsyncOutputQueue(AsyncOutputQueue const&) = delete;
+  AsyncOutputQueue&
+  operator=(AsyncOutputQueue const&) = delete;
+
+  //! Queue a job for the writer thread
+  void
+  push(std::function<void()> job);
+
+  //! Block until all queued jobs have run
+  void
+  flush();
+
+ private:
+  void
+  run();
+
+  void
+  rethrowError();
+
+  int const max_pending_;
+
+  std::deque<std::function<void()>> jobs_;
+
+  //! True while the writer thread is running a job
+  bool busy_{false};
+
+  bool stop_{false};
+
+  std::exception_ptr error_;
+
+  std::mutex mutex_;
+
+  std::condition_variable changed_;
+
+  std::thread writer_;
+};
+
+/*!
+ * \brief Lock serializing the NetCDF and Ioss calls of the writer threads
+ * and of the solver thread; neither library is thread-safe.
+ *
+ * Never wait for a queue (flush() or destruction) while holding it.
+ */
+std::mutex&
+fileIoMutex();
+
+}  // namespace Albany
+
+#endif  // ALBANY_ASYNCOUTPUTQUEUE_HPP
@@ -0,0 +1,412 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_FieldFileReader.hpp"
+
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+char const cache_magic[8] = {'A', 'L', 'B', 'F', 'L', 'D', '0', '1'};
+
+inline bool
+isSpace(char const c)
+{
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' ||
+         c == '\v';
+}
+
+inline char const*
+skipSpace(char const* p, char const* const end)
+{
+  while (p < end && isSpace(*p)) ++p;
+  return p;
+}
+
+// Powers of ten that are exact in double precision
+double const exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+bool
+readFully(int const fd, void* buf, std::size_t n, off_t offset)
+{
+  char* p = static_cast<char*>(buf);
+  while (n > 0) {
+    ssize_t const r = pread(fd, p, n, offset);
+    if (r <= 0) return false;
+    p += r;
+    n -= r;
+    offset += r;
+  }
+  return true;
+}
+
+bool
+writeFully(int const fd, void const* buf, std::size_t n, off_t offset)
+{
+  char const* p = static_cast<char const*>(buf);
+  while (n > 0) {
+    ssize_t const r = pwrite(fd, p, n, offset);
+    if (r <= 0) return false;
+    p += r;
+    n -= r;
+    offset += r;
+  }
+  return true;
+}
+
+// Cache layout: magic, size and modification time of the text file, number
+// of sizes, sizes, number of layer coordinates, layer coordinates, values.
+// Integers are int64, the rest doubles.
+off_t
+cacheDataOffset(std::size_t const num_sizes, std::size_t const num_layers)
+{
+  return sizeof(cache_magic) + 4 * sizeof(std::int64_t) +
+         num_sizes * sizeof(std::int64_t) + num_layers * sizeof(double);
+}
+
+}  // namespace
+
+char const*
+Albany::parseFieldFileNumber(
+    char const* const p,
+    char const* const end,
+    double&           value)
+{
+  char const* token_end = p;
+  while (token_end < end && !isSpace(*token_end)) ++token_end;
+  if (token_end == p) return nullptr;
+
+  // Fast path: at most 19 significant digits and a small decimal exponent,
+  // so that both the mantissa and the power of ten are exact doubles and
+  // a single multiplication or division rounds correctly.
+  char const*   q         = p;
+  bool          negative  = false;
+  std::uint64_t mantissa  = 0;
+  int           digits    = 0;
+  int           exponent  = 0;
+  bool          truncated = false;
+  bool          any_digit = false;
+
+  if (*q == '-' || *q == '+') {
+    negative = *q == '-';
+    ++q;
+  }
+  for (; q < token_end && *q >= '0' && *q <= '9'; ++q) {
+    any_digit = true;
+    if (mantissa == 0 && *q == '0') continue;
+    if (digits < 19) {
+      mantissa = 10 * mantissa + (*q - '0');
+      ++digits;
+    } else {
+      ++exponent;
+      truncated = truncated || *q != '0';
+    }
+  }
+  if (q < token_end && *q == '.') {
+    for (++q; q < token_end && *q >= '0' && *q <= '9'; ++q) {
+      any_digit = true;
+      if (mantissa == 0 && *q == '0') {
+        --exponent;
+      } else if (digits < 19) {
+        mantissa = 10 * mantissa + (*q - '0');
+        ++digits;
+        --exponent;
+      } else {
+        truncated = truncated || *q != '0';
+      }
+    }
+  }
+  if (any_digit && q < token_end && (*q == 'e' || *q == 'E')) {
+    ++q;
+    bool negative_exponent = false;
+    if (q < token_end && (*q == '-' || *q == '+')) {
+      negative_exponent = *q == '-';
+      ++q;
+    }
+    int  e             = 0;
+    bool exponent_digit = false;
+    for (; q < token_end && *q >= '0' && *q <= '9'; ++q) {
+      exponent_digit = true;
+      if (e < 100000) e = 10 * e + (*q - '0');
+    }
+    if (!exponent_digit) any_digit = false;
+    exponent += negative_exponent ? -e : e;
+  }
+
+  if (any_digit && q == token_end && !truncated &&
+      mantissa < (std::uint64_t(1) << 53)) {
+    if (mantissa == 0) {
+      value = negative ? -0.0 : 0.0;
+      return token_end;
+    }
+    if (exponent >= -22 && exponent <= 22) {
+      double const m = static_cast<double>(mantissa);
+      value = exponent < 0 ? m / exact_powers_of_ten[-exponent]
+                           : m * exact_powers_of_ten[exponent];
+      if (negative) value = -value;
+      return token_end;
+    }
+  }
+
+  // Anything else (long mantissas, huge exponents, inf, nan) goes through
+  // strtod, on a null terminated copy of the token.
+  std::string const token(p, token_end);
+  char*             strtod_end = nullptr;
+  value = std::strtod(token.c_str(), &strtod_end);
+  if (strtod_end != token.c_str() + token.size()) return nullptr;
+  return token_end;
+}
+
+Albany::FieldFileReader::FieldFileReader(
+    std::string const&                       fname,
+    int const                                num_sizes,
+    bool const                               layered,
+    bool const                               binary_cache,
+    Teuchos::RCP<Teuchos_Comm const> const& comm)
+    : comm_(comm)
+{
+  if (binary_cache == true && readCache(fname, num_sizes, layered) == true) {
+    from_cache_ = true;
+    return;
+  }
+
+  parseText(fname, num_sizes, layered);
+
+  if (binary_cache == true) writeCache(fname);
+}
+
+void
+Albany::FieldFileReader::parseText(
+    std::string const& fname,
+    int const          num_sizes,
+    bool const         layered)
+{
+  int const fd = open(fname.c_str(), O_RDONLY);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      fd < 0, std::runtime_error,
+      "Error in GenericSTKMeshStruct: unable to open the file " << fname
+                                                                 << ".\n");
+  struct stat st;
+  fstat(fd, &st);
+  std::size_t const size = st.st_size;
+
+  void* const addr =
+      size > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+  close(fd);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      addr == MAP_FAILED, std::runtime_error,
+      "Error in GenericSTKMeshStruct: unable to map the file " << fname
+                                                                << ".\n");
+  if (size > 0) madvise(addr, size, MADV_SEQUENTIAL);
+
+  char const* const begin = static_cast<char const*>(addr);
+  char const* const end   = begin + size;
+
+  // Every rank parses the sizes and the layer coordinates
+  char const* p = begin;
+  double      number;
+  sizes_.resize(num_sizes);
+  num_values_ = 1;
+  for (int i = 0; i < num_sizes; ++i) {
+    p = skipSpace(p, end);
+    char const* const next = parseFieldFileNumber(p, end, number);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        next == nullptr || number < 0 || number != static_cast<GO>(number),
+        std::runtime_error,
+        "Error in GenericSTKMeshStruct: invalid header in file " << fname
+                                                                  << ".\n");
+    p           = next;
+    sizes_[i]   = static_cast<GO>(number);
+    num_values_ *= sizes_[i];
+  }
+  if (layered == true) {
+    layer_coords_.resize(sizes_.back());
+    for (std::size_t il = 0; il < layer_coords_.size(); ++il) {
+      p = skipSpace(p, end);
+      char const* const next = parseFieldFileNumber(p, end, layer_coords_[il]);
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          next == nullptr, std::runtime_error,
+          "Error in GenericSTKMeshStruct: invalid layer coordinates in file "
+              << fname << ".\n");
+      p = next;
+    }
+  }
+
+  // A value belongs to the rank whose byte range holds its first character
+  int const         rank   = comm_->getRank();
+  int const         nranks = comm_->getSize();
+  std::size_t const bytes  = end - p;
+  char const*       q      = p + bytes * rank / nranks;
+  char const* const stop   = p + bytes * (rank + 1) / nranks;
+  if (q > p && !isSpace(q[-1])) {
+    while (q < end && !isSpace(*q)) ++q;
+  }
+
+  values_.clear();
+  values_.reserve(num_values_ / nranks + 1);
+  while (true) {
+    q = skipSpace(q, end);
+    if (q >= stop) break;
+    char const* const next = parseFieldFileNumber(q, end, number);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        next == nullptr, std::runtime_error,
+        "Error in GenericSTKMeshStruct: invalid number at byte "
+            << (q - begin) << " of file " << fname << ".\n");
+    values_.push_back(number);
+    q = next;
+  }
+
+  if (size > 0) munmap(addr, size);
+
+  GO const num_local = values_.size();
+  GO       num_read  = 0;
+  Teuchos::scan(*comm_, Teuchos::REDUCE_SUM, 1, &num_local, &first_value_);
+  first_value_ -= num_local;
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_SUM, 1, &num_local, &num_read);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      num_read != num_values_, Teuchos::Exceptions::InvalidParameterValue,
+      "Error in GenericSTKMeshStruct: file "
+          << fname << " holds " << num_read << " values instead of the "
+          << num_values_ << " given by its header.\n");
+}
+
+bool
+Albany::FieldFileReader::readCache(
+    std::string const& fname,
+    int const          num_sizes,
+    bool const         layered)
+{
+  int ok = 0;
+
+  struct stat text;
+  int const   fd = open((fname + ".bin").c_str(), O_RDONLY);
+  if (fd >= 0 && stat(fname.c_str(), &text) == 0) {
+    char         magic[sizeof(cache_magic)];
+    std::int64_t info[3];
+    off_t        offset = 0;
+    ok = readFully(fd, magic, sizeof(magic), offset) &&
+         std::memcmp(magic, cache_magic, sizeof(magic)) == 0;
+    offset += sizeof(magic);
+    ok = ok && readFully(fd, info, sizeof(info), offset) &&
+         info[0] == text.st_size && info[1] == text.st_mtime &&
+         info[2] == num_sizes;
+    offset += sizeof(info);
+
+    std::vector<std::int64_t> sizes(num_sizes);
+    ok = ok && readFully(fd, sizes.data(), num_sizes * sizeof(std::int64_t),
+                         offset);
+    offset += num_sizes * sizeof(std::int64_t);
+
+    std::int64_t num_layers = 0;
+    ok = ok && readFully(fd, &num_layers, sizeof(num_layers), offset) &&
+         num_layers == (layered ? sizes.back() : 0);
+    offset += sizeof(num_layers);
+
+    if (ok) {
+      sizes_.assign(sizes.begin(), sizes.end());
+      layer_coords_.resize(num_layers);
+      ok = readFully(fd, layer_coords_.data(), num_layers * sizeof(double),
+                     offset);
+      offset += num_layers * sizeof(double);
+    }
+
+    if (ok) {
+      num_values_ = 1;
+      for (auto const n : sizes_) num_values_ *= n;
+      int const rank   = comm_->getRank();
+      int const nranks = comm_->getSize();
+      first_value_     = num_values_ * rank / nranks;
+      GO const next    = num_values_ * (rank + 1) / nranks;
+      values_.resize(next - first_value_);
+      ok = readFully(fd, values_.data(), values_.size() * sizeof(double),
+                     offset + first_value_ * sizeof(double));
+    }
+  }
+  if (fd >= 0) close(fd);
+
+  int all_ok = 0;
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MIN, 1, &ok, &all_ok);
+  if (all_ok == 0) {
+    sizes_.clear();
+    layer_coords_.clear();
+    values_.clear();
+  }
+  return all_ok != 0;
+}
+
+void
+Albany::FieldFileReader::writeCache(std::string const& fname)
+{
+  std::string const tmp_name    = fname + ".bin.tmp";
+  off_t const       data_offset = cacheDataOffset(sizes_.size(), layer_coords_.size());
+
+  // Rank 0 writes the header and sizes the file, then every rank writes
+  // its values in place.
+  int ok = 0;
+  if (comm_->getRank() == 0) {
+    struct stat text;
+    int const   fd = open(tmp_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0 && stat(fname.c_str(), &text) == 0) {
+      std::vector<char> header(data_offset);
+      char*             h = header.data();
+      std::int64_t      info[3] = {
+          static_cast<std::int64_t>(text.st_size),
+          static_cast<std::int64_t>(text.st_mtime),
+          static_cast<std::int64_t>(sizes_.size())};
+      std::memcpy(h, cache_magic, sizeof(cache_magic));
+      h += sizeof(cache_magic);
+      std::memcpy(h, info, sizeof(info));
+      h += sizeof(info);
+      for (auto const n : sizes_) {
+        std::int64_t const n64 = n;
+        std::memcpy(h, &n64, sizeof(n64));
+        h += sizeof(n64);
+      }
+      std::int64_t const num_layers = layer_coords_.size();
+      std::memcpy(h, &num_layers, sizeof(num_layers));
+      h += sizeof(num_layers);
+      std::memcpy(h, layer_coords_.data(), num_layers * sizeof(double));
+
+      ok = writeFully(fd, header.data(), header.size(), 0) &&
+           ftruncate(fd, data_offset + num_values_ * sizeof(double)) == 0;
+    }
+    if (fd >= 0) close(fd);
+  }
+  Teuchos::broadcast(*comm_, 0, 1, &ok);
+
+  if (ok) {
+    int const fd = open(tmp_name.c_str(), O_WRONLY);
+    ok = fd >= 0 &&
+         writeFully(fd, values_.data(), values_.size() * sizeof(double),
+                    data_offset + first_value_ * sizeof(double)) &&
+         fsync(fd) == 0;
+    if (fd >= 0) close(fd);
+  }
+  int all_ok = 0;
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MIN, 1, &ok, &all_ok);
+
+  if (comm_->getRank() == 0) {
+    if (all_ok && std::rename(tmp_name.c_str(), (fname + ".bin").c_str()) == 0)
+      return;
+    std::remove(tmp_name.c_str());
+    std::cout << "Warning in GenericSTKMeshStruct: unable to write the binary "
+              << "cache " << fname << ".bin.\n";
+  }
+}
@@ -0,0 +1,116 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_FIELDFILEREADER_HPP
+#define ALBANY_FIELDFILEREADER_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+/*!
+ * \brief Parallel reader for the ASCII files of the "Required Fields Info"
+ * fields loaded by GenericSTKMeshStruct.
+ *
+ * The files hold \c num_sizes integers (number of entities, then number of
+ * components and/or layers), then the normalized layer coordinates for
+ * layered fields, then the values. Every rank maps the file in memory and
+ * parses the values whose first character lies in its share of the bytes,
+ * so that rank r ends up with values [firstValue(), firstValue() +
+ * values().size()) of the file.
+ *
+ * With \c binary_cache, the values are also written to <file>.bin, which
+ * later runs read instead of the text file for as long as the text file
+ * keeps its size and modification time. Failing to write the cache only
+ * prints a warning.
+ */
+class FieldFileReader
+{
+ public:
+  FieldFileReader(
+      std::string const&                       fname,
+      int                                      num_sizes,
+      bool                                     layered,
+      bool                                     binary_cache,
+      Teuchos::RCP<Teuchos_Comm const> const& comm);
+
+  //! The integers at the top of the file
+  std::vector<GO> const&
+  sizes() const
+  {
+    return sizes_;
+  }
+
+  //! Normalized layer coordinates (layered fields only)
+  std::vector<double> const&
+  layerCoords() const
+  {
+    return layer_coords_;
+  }
+
+  //! Number of values in the file, the product of the sizes
+  GO
+  numValues() const
+  {
+    return num_values_;
+  }
+
+  //! Position in the file of the first value read by this rank
+  GO
+  firstValue() const
+  {
+    return first_value_;
+  }
+
+  std::vector<ST> const&
+  values() const
+  {
+    return values_;
+  }
+
+  //! True if the values came from the binary cache
+  bool
+  readFromCache() const
+  {
+    return from_cache_;
+  }
+
+ private:
+  void
+  parseText(std::string const& fname, int num_sizes, bool layered);
+
+  bool
+  readCache(std::string const& fname, int num_sizes, bool layered);
+
+  void
+  writeCache(std::string const& fname);
+
+  Teuchos::RCP<Teuchos_Comm const> comm_;
+
+  std::vector<GO> sizes_;
+
+  std::vector<double> layer_coords_;
+
+  GO num_values_{0};
+
+  GO first_value_{0};
+
+  std::vector<ST> values_;
+
+  bool from_cache_{false};
+};
+
+//! Parses the number starting at p, independently of the locale. Returns
+//! the end of the number, or nullptr if [p, end) does not start with one.
+char const*
+parseFieldFileNumber(char const* p, char const* end, double& value);
+
+}  // namespace Albany
+
+#endif  // ALBANY_FIELDFILEREADER_HPP
@@ -10,6 +10,7 @@
 
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_GenericSTKMeshStruct.hpp"
+#include "Albany_FieldFileReader.hpp"
 #include "Albany_SideSetSTKMeshStruct.hpp"
 
 #include "Albany_OrdinarySTKFieldContainer.hpp"
@@ -196,6 +197,10 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
   if (exoOutput)
     exoOutFile = params->get<std::string>("Exodus Output File Name");
   exoOutputInterval = params->get<int>("Exodus Write Interval", 1);
+  exoOutputAsync = params->get<bool>("Asynchronous Exodus Output", false);
+  if (exoOutput && exoOutputAsync)
+    setupAsyncOutput(commT);
+  nodeOrdering = params->get<std::string>("Node Ordering", "None");
   cdfOutput = params->isType<std::string>("NetCDF Output File Name");
   if (cdfOutput)
     cdfOutFile = params->get<std::string>("NetCDF Output File Name");
@@ -244,6 +249,66 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
 
 }
 
+void Albany::GenericSTKMeshStruct::setupAsyncOutput(
+    const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
+  exoOutputStagingFields.clear();
+
+#ifndef ALBANY_SEACAS
+  exoOutputAsync = false;
+#else
+#if !defined(HAVE_TEUCHOS_THREAD_SAFE)
+  // The writer thread shares RCPs with the solver thread
+  if (commT->getRank() == 0)
+    *out << "\nWARNING: Asynchronous Exodus Output requires Trilinos configured "
+         << "with Teuchos_ENABLE_THREAD_SAFE=ON: writing exodus output synchronously \n"
+         << std::endl;
+  exoOutputAsync = false;
+  return;
+#endif
+
+  // Ioss communicates on the writer thread, so with more than one rank
+  // MPI has to allow calls from several threads at once.
+  int thread_level = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&thread_level);
+  if (commT->getSize() > 1 && thread_level < MPI_THREAD_MULTIPLE) {
+    if (commT->getRank() == 0)
+      *out << "\nWARNING: Asynchronous Exodus Output requires MPI initialized "
+           << "with MPI_THREAD_MULTIPLE: writing exodus output synchronously \n"
+           << std::endl;
+    exoOutputAsync = false;
+    return;
+  }
+
+  // At each output step the fields are copied into their staging fields on
+  // the solver thread, and the writer thread writes the staging fields under
+  // the original names. The coordinates only change through
+  // transferSolutionToCoords, which waits for the writer.
+  const stk::mesh::FieldBase* coordinates = metaData->coordinate_field();
+  const stk::mesh::FieldVector fields = metaData->get_fields();
+  for (size_t i = 0; i < fields.size(); i++) {
+    stk::mesh::FieldBase& field = *fields[i];
+    if (&field == coordinates)
+      continue;
+
+    stk::mesh::FieldBase* staging = metaData->declare_field_base(
+        field.name() + "_async_output", field.entity_rank(), field.data_traits(),
+        field.field_array_rank(), field.dimension_tags(), 1);
+    const stk::mesh::FieldRestrictionVector& restrictions = field.restrictions();
+    for (size_t r = 0; r < restrictions.size(); r++)
+      metaData->declare_field_restriction(*staging, restrictions[r].selector(),
+          restrictions[r].num_scalars_per_entity(), restrictions[r].dimension());
+
+    const Ioss::Field::RoleType* role = stk::io::get_field_role(field);
+    if (role != NULL)
+      stk::io::set_field_role(*staging, *role);
+
+    exoOutputStagingFields.push_back(std::make_pair(&field, staging));
+  }
+#endif
+}
+
 void Albany::GenericSTKMeshStruct::setAllPartsIO()
 {
   for (auto& it : partVec)
@@ -1303,7 +1368,7 @@ void Albany::GenericSTKMeshStruct::loadField (const std::string& field_name, con
                                               const Teuchos::RCP<const Teuchos_Comm>& commT,
                                               bool node, bool scalar, bool layered)
 {
-  std::vector<double>* norm_layers_coords;
+  std::vector<double>* norm_layers_coords = nullptr;
 
   // Getting the serial and (possibly) parallel maps
   const Teuchos::RCP<const Tpetra_Map> serial_map = importOperator.getSourceMap();
@@ -1321,6 +1386,9 @@ void Albany::GenericSTKMeshStruct::loadField (const std::string& field_name, con
   // The serial Tpetra service multivector
   Teuchos::RCP<Tpetra_MultiVector> serial_req_mvec;
 
+  // The (possibly) parallel multivector, filled directly by the parallel reader
+  Teuchos::RCP<Tpetra_MultiVector> req_mvec;
+
   if (params.isParameter("Random Value"))
   {
     Teuchos::Array<std::string> randomize = params.get<Teuchos::Array<std::string> >("Random Value");
@@ -1409,7 +1477,16 @@ void Albany::GenericSTKMeshStruct::loadField (const std::string& field_name, con
     out->getOStream()->flush();
     // Read the input file and stuff it in the Tpetra multivector
 
-    if (scalar)
+    if (this->params->get<bool>("Parallel Field Input", false))
+    {
+      if (layered)
+      {
+        temp_str = field_name + "_NLC";
+        norm_layers_coords = &fieldContainer->getMeshVectorStates()[temp_str];
+      }
+      readFileParallel (fname,req_mvec,importOperator,scalar,layered,norm_layers_coords,commT);
+    }
+    else if (scalar)
     {
       if (layered)
       {
@@ -1448,24 +1525,31 @@ void Albany::GenericSTKMeshStruct::loadField (const std::string& field_name, con
     if (params.isParameter("Scale Factor"))
     {
       Teuchos::Array<double> scale_factors = params.get<Teuchos::Array<double> >("Scale Factor");
-      TEUCHOS_TEST_FOR_EXCEPTION (scale_factors.size()!=serial_req_mvec->getNumVectors(), Teuchos::Exceptions::InvalidParameter,
+      const size_t num_vectors = req_mvec.is_null() ? serial_req_mvec->getNumVectors() : req_mvec->getNumVectors();
+      TEUCHOS_TEST_FOR_EXCEPTION (scale_factors.size()!=num_vectors, Teuchos::Exceptions::InvalidParameter,
                                   "Error! The given scale factors vector size does not match the field dimension.\n");
       *out << "   - Scaling " << field_type << " field '" << field_name << "' with scaling factors [" << scale_factors[0];
       for (int i=1; i<scale_factors.size(); ++i)
         *out << " " << scale_factors[i];
       *out << "]\n";
 
-      serial_req_mvec->scale (scale_factors);
+      if (req_mvec.is_null())
+        serial_req_mvec->scale (scale_factors);
+      else
+        req_mvec->scale (scale_factors);
     }
   }
 
   // Fill the (possibly) parallel vector
-  Tpetra_MultiVector req_mvec(map,serial_req_mvec->getNumVectors());
-  req_mvec.doImport(*serial_req_mvec,importOperator,Tpetra::INSERT);
+  if (req_mvec.is_null())
+  {
+    req_mvec = Teuchos::rcp(new Tpetra_MultiVector(map,serial_req_mvec->getNumVectors()));
+    req_mvec->doImport(*serial_req_mvec,importOperator,Tpetra::INSERT);
+  }
   std::vector<Teuchos::ArrayRCP<const ST> > req_mvec_view;
 
-  for (int i(0); i<req_mvec.getNumVectors(); ++i)
-    req_mvec_view.push_back(req_mvec.getVector(i)->get1dView());
+  for (int i(0); i<req_mvec->getNumVectors(); ++i)
+    req_mvec_view.push_back(req_mvec->getVector(i)->get1dView());
 
   //Now we have to stuff the vector in the mesh data
   typedef AbstractSTKFieldContainer::ScalarFieldType  SFT;
@@ -1675,6 +1759,105 @@ void Albany::GenericSTKMeshStruct::readLayeredVectorFileSerial (const std::strin
     mvec = Teuchos::rcp(new Tpetra_MultiVector(map,numVectors));
 }
 
+void Albany::GenericSTKMeshStruct::readFileParallel (const std::string& fname, Teuchos::RCP<Tpetra_MultiVector>& mvec,
+                                                     const Tpetra_Import& importOperator, bool scalar, bool layered,
+                                                     std::vector<double>* normalizedLayersCoords,
+                                                     const Teuchos::RCP<const Teuchos_Comm>& comm) const
+{
+  const Teuchos::RCP<const Tpetra_Map> serial_map = importOperator.getSourceMap();
+  const Teuchos::RCP<const Tpetra_Map> map = importOperator.getTargetMap();
+
+  // Same headers as in the read*FileSerial methods
+  int numSizes = 1 + (scalar ? 0 : 1) + (layered ? 1 : 0);
+  FieldFileReader reader (fname, numSizes, layered, params->get<bool>("Field Input Binary Cache", false), comm);
+
+  const std::vector<GO>& sizes = reader.sizes();
+  GO numNodes = sizes[0];
+  const GO numExpected = static_cast<GO>(serial_map->getGlobalNumElements());
+  TEUCHOS_TEST_FOR_EXCEPTION (numNodes != numExpected, Teuchos::Exceptions::InvalidParameterValue,
+                              "Error in GenericSTKMeshStruct: Number of nodes in file " << fname << " (" << numNodes << ") " <<
+                              "is different from the number expected (" << numExpected << ").\n");
+
+  int numComponents = scalar ? 1 : sizes[1];
+  int numLayers = layered ? sizes.back() : 1;
+  if (layered)
+  {
+    TEUCHOS_TEST_FOR_EXCEPTION (scalar && numLayers != static_cast<int>(normalizedLayersCoords->size()), Teuchos::Exceptions::InvalidParameterValue,
+                                "Error in GenericSTKMeshStruct: Number of layers in file " << fname << " (" << numLayers << ") " <<
+                                "is different from the number expected (" << normalizedLayersCoords->size() << ")." <<
+                                " To fix this, please specify the correct layered data dimension when you register the state.\n");
+    *normalizedLayersCoords = reader.layerCoords();
+  }
+
+  int numVectors = numComponents*numLayers;
+  mvec = Teuchos::rcp(new Tpetra_MultiVector(map,numVectors));
+
+  // The file lists the entities by increasing GID, the order of the serial
+  // map. When the GIDs have no gaps, the position in the file of an entity
+  // of the target map is its GID minus the smallest one. Otherwise it is its
+  // index in the serial map, imported from rank 0, which then holds a vector
+  // of numNodes positions (though never the values of the field).
+  const size_t numLocal = map->getNodeNumElements();
+  const Tpetra_GO minGID = map->getMinAllGlobalIndex();
+  const bool denseGIDs = map->getMaxAllGlobalIndex() - minGID + 1 == numNodes &&
+                         map->getGlobalNumElements() == serial_map->getGlobalNumElements();
+  Teuchos::Array<Tpetra_GO> positions(numLocal);
+  if (denseGIDs)
+  {
+    for (size_t lid=0; lid<numLocal; ++lid)
+      positions[lid] = map->getGlobalElement(lid) - minGID;
+  }
+  else
+  {
+    Tpetra_Vector serial_positions(serial_map);
+    {
+      Teuchos::ArrayRCP<ST> view = serial_positions.get1dViewNonConst();
+      for (LO i=0; i<view.size(); ++i)
+        view[i] = i;
+    }
+    Tpetra_Vector target_positions(map);
+    target_positions.doImport(serial_positions,importOperator,Tpetra::INSERT);
+    Teuchos::ArrayRCP<const ST> view = target_positions.get1dView();
+    for (size_t lid=0; lid<numLocal; ++lid)
+      positions[lid] = static_cast<Tpetra_GO>(view[lid]);
+  }
+
+  // Value k of the file is entity k%numNodes of block k/numNodes. Import the
+  // values of the local entities from the ranks that parsed them.
+  Teuchos::Array<Tpetra_GO> values_gids(numVectors*numLocal);
+  for (int block=0; block<numVectors; ++block)
+    for (size_t lid=0; lid<numLocal; ++lid)
+      values_gids[block*numLocal+lid] = block*numNodes + positions[lid];
+
+  const Tpetra::global_size_t INVALID = Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid();
+  Teuchos::RCP<const Tpetra_Map> file_map = Teuchos::rcp(new Tpetra_Map(reader.numValues(), reader.values().size(), 0, comm));
+  Teuchos::RCP<const Tpetra_Map> values_map = Teuchos::rcp(new Tpetra_Map(INVALID, values_gids(), 0, comm));
+
+  Tpetra_Vector file_values(file_map);
+  {
+    Teuchos::ArrayRCP<ST> view = file_values.get1dViewNonConst();
+    std::copy(reader.values().begin(), reader.values().end(), view.begin());
+  }
+  Tpetra_Vector values(values_map);
+  values.doImport(file_values,Tpetra_Import(file_map,values_map),Tpetra::INSERT);
+  Teuchos::ArrayRCP<const ST> values_view = values.get1dView();
+
+  // Layer ordering: see readLayeredVectorFileSerial
+  for (int block=0; block<numVectors; ++block)
+  {
+    int ivec = block;
+    if (layered && !scalar)
+    {
+      int il = block / numComponents;
+      int icomp = block % numComponents;
+      ivec = icomp*numLayers+il;
+    }
+    Teuchos::ArrayRCP<ST> nonConstView = mvec->getVectorNonConst(ivec)->get1dViewNonConst();
+    for (size_t lid=0; lid<numLocal; ++lid)
+      nonConstView[lid] = values_view[block*numLocal+lid];
+  }
+}
+
 void Albany::GenericSTKMeshStruct::checkFieldIsInMesh (const std::string& fname, const std::string& ftype) const
 {
   stk::topology::rank_t entity_rank;
@@ -1771,6 +1954,8 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
 #endif
   validPL->set<bool>("Output DTK Field to Exodus", true, "Boolean indicating whether to write dtk field to exodus file");  
   validPL->set<int>("Exodus Write Interval", 3, "Step interval to write solution data to Exodus file");
+  validPL->set<bool>("Asynchronous Exodus Output", false,
+      "Finish each Exodus output step on a background writer thread. Requires SEACAS build");
   validPL->set<std::string>("NetCDF Output File Name", "",
       "Request NetCDF output to given file name. Requires SEACAS build");
   validPL->set<int>("NetCDF Write Interval", 1, "Step interval to write solution data to NetCDF file");
@@ -1783,7 +1968,20 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
   validPL->set<int>("Cubature Degree", 3, "Integration order sent to Intrepid2");
   validPL->set<std::string>("Cubature Rule", "", "Integration rule sent to Intrepid2: GAUSS, GAUSS_RADAU_LEFT, GAUSS_RADAU_RIGHT, GAUSS_LOBATTO");
   validPL->set<int>("Workset Size", DEFAULT_WORKSET_SIZE, "Upper bound on workset (bucket) size");
+  validPL->set<std::string>("Node Ordering", "None",
+      "Local node numbering for locality in gather, scatter and matrix operations: None (STK bucket order), Reverse Cuthill-McKee or Hilbert");
+  validPL->set<bool>("Autotune Workset Size", false,
+      "Time residual and Jacobian fills with the Autotune Workset Sizes in increasing order at startup, stopping at the first slower one, and use the fastest as Workset Size");
+  validPL->set<Teuchos::Array<int> >("Autotune Workset Sizes",
+      Teuchos::tuple<int>(32, 128, 512),
+      "Candidate workset sizes for Autotune Workset Size. Each one costs a full setup of a trial application, reading the mesh again; sizes beyond the largest element block are skipped");
+  validPL->set<int>("Autotune Fills", 3,
+      "Timed residual and Jacobian fills per candidate workset size");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
+  validPL->set<bool>("Parallel Field Input", false,
+                     "Read the files of 'Required Fields Info' on all ranks at once (needs a shared file system)");
+  validPL->set<bool>("Field Input Binary Cache", false,
+                     "With Parallel Field Input, keep a binary copy <file>.bin of each field file for later runs");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
   validPL->set<bool>("Separate Evaluators by Element Block", false,
                      "Flag for different evaluation trees for each Element Block");
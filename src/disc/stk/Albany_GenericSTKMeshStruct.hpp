@@ -90,6 +90,10 @@ namespace Albany {
     //! Sets all mesh parts as IO parts (will be written to file)
     void setAllPartsIO();
 
+    //! Declare the staging copies of the output fields used by asynchronous
+    //! exodus output, or turn it off if this build or MPI cannot support it
+    void setupAsyncOutput(const Teuchos::RCP<const Teuchos_Comm>& commT);
+
     //! Determine if a percept mesh object is needed
     bool buildEMesh;
     bool buildPerceptEMesh();
@@ -140,6 +144,14 @@ namespace Albany {
                                       std::vector<double>& normalizedLayersCoords,
                                       const Teuchos::RCP<const Teuchos_Comm>& comm) const;
 
+    //! Reads any field file on all ranks at once (see Albany::FieldFileReader),
+    //! returning a multivector on the target map of importOperator. The serial
+    //! source map is only used when the GIDs of the target map have gaps
+    void readFileParallel (const std::string& fname, Teuchos::RCP<Tpetra_MultiVector>& contentVec,
+                           const Tpetra_Import& importOperator, bool scalar, bool layered,
+                           std::vector<double>* normalizedLayersCoords,
+                           const Teuchos::RCP<const Teuchos_Comm>& comm) const;
+
     void checkFieldIsInMesh (const std::string& fname, const std::string& ftype) const;
 
     //! Perform initial adaptation input checking
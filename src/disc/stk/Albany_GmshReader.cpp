@@ -0,0 +1,695 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_GmshReader.hpp"
+#include "Albany_FieldFileReader.hpp"
+
+#include "Teuchos_TestForException.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Nodes of the Gmsh element types Albany reads: 2-pt line, 3-pt triangle,
+// 4-pt quadrangle, 4-pt tetrahedron, 8-pt hexahedron and point.
+int
+numTypeNodes(long long const type)
+{
+  switch (type) {
+    case 1: return 2;
+    case 2: return 3;
+    case 3: return 4;
+    case 4: return 4;
+    case 5: return 8;
+    case 15: return 1;
+    default: return 0;
+  }
+}
+
+class GmshParser
+{
+ public:
+  GmshParser(
+      std::string const&    fname,
+      char const*           begin,
+      char const*           end,
+      Albany::GmshMesh&     mesh)
+      : fname_(fname), p_(begin), end_(end), mesh_(mesh)
+  {
+  }
+
+  void
+  parse();
+
+ private:
+  // ASCII tokens
+  void
+  skipSpace()
+  {
+    while (p_ < end_ && (*p_ == ' ' || *p_ == '\n' || *p_ == '\r' ||
+                         *p_ == '\t'))
+      ++p_;
+  }
+
+  std::string
+  word();
+
+  long long
+  integer();
+
+  double
+  real();
+
+  // Binary data starts right after the end of the current line
+  void
+  endOfLine();
+
+  template <typename T>
+  T
+  raw()
+  {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        end_ - p_ < static_cast<std::ptrdiff_t>(sizeof(T)), std::runtime_error,
+        "Error! Unexpected end of mesh file '" << fname_ << "'.\n");
+    T value;
+    std::memcpy(&value, p_, sizeof(T));
+    p_ += sizeof(T);
+    return value;
+  }
+
+  void
+  endSection(std::string const& end_name);
+
+  void
+  skipSection(std::string const& name);
+
+  void
+  readFormat();
+
+  void
+  readEntities();
+
+  void
+  readNodes();
+
+  void
+  readElements();
+
+  void
+  readLegacyNodes();
+
+  void
+  readLegacyElements();
+
+  // Appends a node. Coordinates are added separately, since the 4.1 format
+  // lists all the tags of a block before the coordinates.
+  void
+  addNodeTag(long long const tag)
+  {
+    contiguous_ = contiguous_ && tag == static_cast<long long>(node_tags_.size()) + 1;
+    node_tags_.push_back(tag);
+  }
+
+  void
+  finishNodes();
+
+  // Position (1-based) of the node with Gmsh tag \c tag
+  int
+  node(long long const tag) const;
+
+  // Storage for an element type, or nullptr for points
+  Albany::GmshMesh::Elements*
+  elements(long long type);
+
+  int
+  entityTag(int dim, int entity) const;
+
+  std::string const& fname_;
+  char const*        p_;
+  char const* const  end_;
+  Albany::GmshMesh&  mesh_;
+
+  bool format_read_{false};
+  bool nodes_read_{false};
+
+  std::vector<long long>                  node_tags_;
+  bool                                    contiguous_{true};
+  std::vector<int>                        dense_index_;
+  std::unordered_map<long long, int>      sparse_index_;
+  std::map<int, int>                      physical_[4];
+};
+
+std::string
+GmshParser::word()
+{
+  skipSpace();
+  char const* const first = p_;
+  while (p_ < end_ && *p_ != ' ' && *p_ != '\n' && *p_ != '\r' && *p_ != '\t')
+    ++p_;
+  return std::string(first, p_);
+}
+
+long long
+GmshParser::integer()
+{
+  skipSpace();
+  bool negative = false;
+  if (p_ < end_ && (*p_ == '-' || *p_ == '+')) {
+    negative = *p_ == '-';
+    ++p_;
+  }
+  char const* const first = p_;
+  long long         value = 0;
+  for (; p_ < end_ && *p_ >= '0' && *p_ <= '9'; ++p_)
+    value = 10 * value + (*p_ - '0');
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      p_ == first, std::runtime_error,
+      "Error! Integer expected in mesh file '" << fname_ << "'.\n");
+  return negative ? -value : value;
+}
+
+double
+GmshParser::real()
+{
+  skipSpace();
+  double            value;
+  char const* const next = Albany::parseFieldFileNumber(p_, end_, value);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      next == nullptr, std::runtime_error,
+      "Error! Number expected in mesh file '" << fname_ << "'.\n");
+  p_ = next;
+  return value;
+}
+
+void
+GmshParser::endOfLine()
+{
+  while (p_ < end_ && *p_ != '\n') ++p_;
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      p_ == end_, std::runtime_error,
+      "Error! Unexpected end of mesh file '" << fname_ << "'.\n");
+  ++p_;
+}
+
+void
+GmshParser::endSection(std::string const& end_name)
+{
+  std::string const w = word();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      w != end_name, std::runtime_error,
+      "Error! Expected '" << end_name << "' in mesh file '" << fname_
+                          << "', found '" << w << "'.\n");
+}
+
+void
+GmshParser::skipSection(std::string const& name)
+{
+  std::string const marker = "\n$End" + name;
+  p_ = std::search(p_, end_, marker.begin(), marker.end());
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      p_ == end_, std::runtime_error,
+      "Error! Section '" << name << "' of mesh file '" << fname_
+                         << "' is not terminated.\n");
+  p_ += marker.size();
+}
+
+void
+GmshParser::parse()
+{
+  while (true) {
+    skipSpace();
+    if (p_ == end_) break;
+
+    std::string const w = word();
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        w.size() < 2 || w[0] != '$', std::runtime_error,
+        "Error! Section header expected in mesh file '" << fname_
+                                                        << "', found '" << w
+                                                        << "'.\n");
+    std::string const name = w.substr(1);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        !format_read_ && name != "MeshFormat" && name != "NOD",
+        std::runtime_error, "Error! Mesh format not recognized.\n");
+
+    if (name == "MeshFormat") {
+      readFormat();
+      endSection("$EndMeshFormat");
+    } else if (name == "NOD") {
+      readLegacyNodes();
+      endSection("$ENDNOD");
+    } else if (name == "ELM") {
+      readLegacyElements();
+      endSection("$ENDELM");
+    } else if (name == "Entities" && mesh_.version >= 4) {
+      readEntities();
+      endSection("$EndEntities");
+    } else if (name == "Nodes") {
+      readNodes();
+      endSection("$EndNodes");
+    } else if (name == "Elements") {
+      readElements();
+      endSection("$EndElements");
+    } else {
+      skipSection(name);
+    }
+  }
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !nodes_read_, std::runtime_error,
+      "Error! Nodes section not found in mesh file '" << fname_ << "'.\n");
+}
+
+void
+GmshParser::readFormat()
+{
+  mesh_.version       = real();
+  mesh_.binary        = integer() != 0;
+  long long const dsz = integer();
+  format_read_        = true;
+
+  bool const v2 = mesh_.version >= 2 && mesh_.version < 3;
+  bool const v4 = mesh_.version >= 4 && mesh_.version < 5;
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !v2 && !v4, std::runtime_error,
+      "Error! Gmsh format " << mesh_.version << " of mesh file '" << fname_
+                            << "' not supported.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      mesh_.binary && v4 && mesh_.version < 4.1, std::runtime_error,
+      "Error! Binary Gmsh format 4.0 of mesh file '"
+          << fname_ << "' not supported; save it in format 4.1.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      dsz != 8, std::runtime_error,
+      "Error! Data size " << dsz << " of mesh file '" << fname_
+                          << "' not supported.\n");
+
+  if (mesh_.binary) {
+    endOfLine();
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        raw<int>() != 1, std::runtime_error,
+        "Error! Binary mesh file '" << fname_
+                                    << "' was written with a different "
+                                       "endianness.\n");
+  }
+}
+
+void
+GmshParser::readEntities()
+{
+  bool const binary = mesh_.binary;
+  if (binary) endOfLine();
+
+  std::uint64_t count[4];
+  for (int dim = 0; dim < 4; ++dim)
+    count[dim] = binary ? raw<std::uint64_t>() : integer();
+
+  // Points have a bounding box in 4.0 and just a position in 4.1
+  for (int dim = 0; dim < 4; ++dim) {
+    int const num_doubles = (dim == 0 && mesh_.version >= 4.1) ? 3 : 6;
+    for (std::uint64_t i = 0; i < count[dim]; ++i) {
+      int const tag = binary ? raw<int>() : integer();
+      for (int k = 0; k < num_doubles; ++k) binary ? raw<double>() : real();
+
+      std::uint64_t const num_physicals =
+          binary ? raw<std::uint64_t>() : integer();
+      for (std::uint64_t k = 0; k < num_physicals; ++k) {
+        int const physical = binary ? raw<int>() : integer();
+        if (k == 0) physical_[dim][tag] = physical;
+      }
+      if (dim > 0) {
+        std::uint64_t const num_bounding =
+            binary ? raw<std::uint64_t>() : integer();
+        for (std::uint64_t k = 0; k < num_bounding; ++k)
+          binary ? raw<int>() : integer();
+      }
+    }
+  }
+}
+
+void
+GmshParser::readNodes()
+{
+  std::vector<double>& coords = mesh_.coords;
+
+  if (mesh_.version < 3) {
+    long long const num_nodes = integer();
+    node_tags_.reserve(num_nodes);
+    coords.reserve(3 * num_nodes);
+    if (mesh_.binary) {
+      endOfLine();
+      for (long long i = 0; i < num_nodes; ++i) {
+        addNodeTag(raw<int>());
+        for (int k = 0; k < 3; ++k) coords.push_back(raw<double>());
+      }
+    } else {
+      for (long long i = 0; i < num_nodes; ++i) {
+        addNodeTag(integer());
+        for (int k = 0; k < 3; ++k) coords.push_back(real());
+      }
+    }
+  } else if (mesh_.binary) {
+    endOfLine();
+    std::uint64_t const num_blocks = raw<std::uint64_t>();
+    std::uint64_t const num_nodes  = raw<std::uint64_t>();
+    raw<std::uint64_t>();  // min tag
+    raw<std::uint64_t>();  // max tag
+    node_tags_.reserve(num_nodes);
+    coords.reserve(3 * num_nodes);
+    for (std::uint64_t b = 0; b < num_blocks; ++b) {
+      int const           dim        = raw<int>();
+      raw<int>();  // entity tag
+      int const           parametric = raw<int>();
+      std::uint64_t const n          = raw<std::uint64_t>();
+      for (std::uint64_t i = 0; i < n; ++i)
+        addNodeTag(static_cast<long long>(raw<std::uint64_t>()));
+      int const num_params = parametric ? dim : 0;
+      for (std::uint64_t i = 0; i < n; ++i) {
+        for (int k = 0; k < 3; ++k) coords.push_back(raw<double>());
+        for (int k = 0; k < num_params; ++k) raw<double>();
+      }
+    }
+  } else {
+    bool const          v41        = mesh_.version >= 4.1;
+    long long const     num_blocks = integer();
+    long long const     num_nodes  = integer();
+    if (v41) {
+      integer();  // min tag
+      integer();  // max tag
+    }
+    node_tags_.reserve(num_nodes);
+    coords.reserve(3 * num_nodes);
+    for (long long b = 0; b < num_blocks; ++b) {
+      // 4.1: dim, entity, parametric, n. 4.0: entity, dim, parametric, n.
+      long long const first      = integer();
+      long long const second     = integer();
+      int const       dim        = v41 ? first : second;
+      int const       parametric = integer();
+      long long const n          = integer();
+      int const       num_params = parametric ? dim : 0;
+      if (v41) {
+        for (long long i = 0; i < n; ++i) addNodeTag(integer());
+        for (long long i = 0; i < n; ++i) {
+          for (int k = 0; k < 3; ++k) coords.push_back(real());
+          for (int k = 0; k < num_params; ++k) real();
+        }
+      } else {
+        for (long long i = 0; i < n; ++i) {
+          addNodeTag(integer());
+          for (int k = 0; k < 3; ++k) coords.push_back(real());
+          for (int k = 0; k < num_params; ++k) real();
+        }
+      }
+    }
+  }
+
+  finishNodes();
+}
+
+void
+GmshParser::readLegacyNodes()
+{
+  mesh_.version = 1;
+  format_read_  = true;
+
+  long long const num_nodes = integer();
+  node_tags_.reserve(num_nodes);
+  mesh_.coords.reserve(3 * num_nodes);
+  for (long long i = 0; i < num_nodes; ++i) {
+    addNodeTag(integer());
+    for (int k = 0; k < 3; ++k) mesh_.coords.push_back(real());
+  }
+
+  finishNodes();
+}
+
+void
+GmshParser::finishNodes()
+{
+  nodes_read_ = true;
+  if (contiguous_) return;
+
+  // Gmsh numbers nodes 1..N in order unless the mesh was renumbered or
+  // partitioned; otherwise map the tags to their position in the file.
+  long long const max_tag =
+      *std::max_element(node_tags_.begin(), node_tags_.end());
+  if (max_tag <= 4 * static_cast<long long>(node_tags_.size())) {
+    dense_index_.assign(max_tag + 1, 0);
+    for (std::size_t i = 0; i < node_tags_.size(); ++i)
+      if (node_tags_[i] > 0) dense_index_[node_tags_[i]] = i + 1;
+  } else {
+    sparse_index_.reserve(node_tags_.size());
+    for (std::size_t i = 0; i < node_tags_.size(); ++i)
+      sparse_index_[node_tags_[i]] = i + 1;
+  }
+}
+
+int
+GmshParser::node(long long const tag) const
+{
+  int index = 0;
+  if (contiguous_) {
+    if (tag >= 1 && tag <= static_cast<long long>(node_tags_.size()))
+      index = tag;
+  } else if (!dense_index_.empty()) {
+    if (tag >= 1 && tag < static_cast<long long>(dense_index_.size()))
+      index = dense_index_[tag];
+  } else {
+    auto const it = sparse_index_.find(tag);
+    if (it != sparse_index_.end()) index = it->second;
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      index == 0, std::runtime_error,
+      "Error! Element of mesh file '" << fname_ << "' refers to node " << tag
+                                      << ", which is not listed.\n");
+  return index;
+}
+
+Albany::GmshMesh::Elements*
+GmshParser::elements(long long const type)
+{
+  switch (type) {
+    case 1: return &mesh_.lines;
+    case 2: return &mesh_.trias;
+    case 3: return &mesh_.quads;
+    case 4: return &mesh_.tetra;
+    case 5: return &mesh_.hexas;
+    case 15: return nullptr;
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true, std::runtime_error,
+          "Error! Element type " << type << " of mesh file '" << fname_
+                                 << "' not supported.\n");
+  }
+  return nullptr;
+}
+
+int
+GmshParser::entityTag(int const dim, int const entity) const
+{
+  if (dim < 0 || dim > 3) return entity;
+  auto const it = physical_[dim].find(entity);
+  return it != physical_[dim].end() ? it->second : entity;
+}
+
+void
+GmshParser::readElements()
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !nodes_read_, std::runtime_error,
+      "Error! Elements section found before the nodes in mesh file '"
+          << fname_ << "'.\n");
+
+  if (mesh_.version < 3 && !mesh_.binary) {
+    // id type num_tags tags... nodes..., the first tag being the physical one
+    long long const num_elements = integer();
+    for (long long i = 0; i < num_elements; ++i) {
+      integer();
+      long long const type     = integer();
+      long long const num_tags = integer();
+      int             tag      = 0;
+      for (long long k = 0; k < num_tags; ++k) {
+        long long const t = integer();
+        if (k == 0) tag = t;
+      }
+      Albany::GmshMesh::Elements* const block = elements(type);
+      int const                         nn    = numTypeNodes(type);
+      if (block == nullptr) {
+        for (int k = 0; k < nn; ++k) integer();
+        continue;
+      }
+      for (int k = 0; k < nn; ++k) block->nodes.push_back(node(integer()));
+      block->tags.push_back(tag);
+    }
+  } else if (mesh_.version < 3) {
+    // Blocks of elements of one type: type, count, num_tags, then the
+    // elements as id, tags..., nodes...
+    long long const num_elements = integer();
+    endOfLine();
+    for (long long read = 0; read < num_elements;) {
+      int const type     = raw<int>();
+      int const count    = raw<int>();
+      int const num_tags = raw<int>();
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          count <= 0, std::runtime_error,
+          "Error! Invalid element block in mesh file '" << fname_ << "'.\n");
+      Albany::GmshMesh::Elements* const block = elements(type);
+      int const                         nn    = numTypeNodes(type);
+      if (block != nullptr) {
+        block->nodes.reserve(block->nodes.size() + count * nn);
+        block->tags.reserve(block->tags.size() + count);
+      }
+      for (int i = 0; i < count; ++i) {
+        raw<int>();
+        int tag = 0;
+        for (int k = 0; k < num_tags; ++k) {
+          int const t = raw<int>();
+          if (k == 0) tag = t;
+        }
+        if (block == nullptr) {
+          for (int k = 0; k < nn; ++k) raw<int>();
+          continue;
+        }
+        for (int k = 0; k < nn; ++k) block->nodes.push_back(node(raw<int>()));
+        block->tags.push_back(tag);
+      }
+      read += count;
+    }
+  } else if (mesh_.binary) {
+    endOfLine();
+    std::uint64_t const num_blocks = raw<std::uint64_t>();
+    raw<std::uint64_t>();  // number of elements
+    raw<std::uint64_t>();  // min tag
+    raw<std::uint64_t>();  // max tag
+    for (std::uint64_t b = 0; b < num_blocks; ++b) {
+      int const                         dim    = raw<int>();
+      int const                         entity = raw<int>();
+      int const                         type   = raw<int>();
+      std::uint64_t const               n      = raw<std::uint64_t>();
+      Albany::GmshMesh::Elements* const block  = elements(type);
+      int const                         nn     = numTypeNodes(type);
+      if (block == nullptr) {
+        for (std::uint64_t i = 0; i < n * (1 + nn); ++i)
+          raw<std::uint64_t>();
+        continue;
+      }
+      int const tag = entityTag(dim, entity);
+      block->nodes.reserve(block->nodes.size() + n * nn);
+      block->tags.resize(block->tags.size() + n, tag);
+      for (std::uint64_t i = 0; i < n; ++i) {
+        raw<std::uint64_t>();
+        for (int k = 0; k < nn; ++k)
+          block->nodes.push_back(
+              node(static_cast<long long>(raw<std::uint64_t>())));
+      }
+    }
+  } else {
+    bool const      v41        = mesh_.version >= 4.1;
+    long long const num_blocks = integer();
+    integer();  // number of elements
+    if (v41) {
+      integer();  // min tag
+      integer();  // max tag
+    }
+    for (long long b = 0; b < num_blocks; ++b) {
+      // 4.1: dim, entity, type, n. 4.0: entity, dim, type, n.
+      long long const                   first  = integer();
+      long long const                   second = integer();
+      int const                         dim    = v41 ? first : second;
+      int const                         entity = v41 ? second : first;
+      long long const                   type   = integer();
+      long long const                   n      = integer();
+      Albany::GmshMesh::Elements* const block  = elements(type);
+      int const                         nn     = numTypeNodes(type);
+      if (block == nullptr) {
+        for (long long i = 0; i < n * (1 + nn); ++i) integer();
+        continue;
+      }
+      int const tag = entityTag(dim, entity);
+      block->nodes.reserve(block->nodes.size() + n * nn);
+      block->tags.resize(block->tags.size() + n, tag);
+      for (long long i = 0; i < n; ++i) {
+        integer();
+        for (int k = 0; k < nn; ++k) block->nodes.push_back(node(integer()));
+      }
+    }
+  }
+}
+
+void
+GmshParser::readLegacyElements()
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !nodes_read_, std::runtime_error,
+      "Error! Element section found before the nodes in mesh file '"
+          << fname_ << "'.\n");
+
+  // id type reg_phys reg_elem num_nodes nodes...
+  long long const num_elements = integer();
+  for (long long i = 0; i < num_elements; ++i) {
+    integer();
+    long long const type     = integer();
+    int const       reg_phys = integer();
+    integer();
+    long long const num_nodes = integer();
+
+    Albany::GmshMesh::Elements* const block = elements(type);
+    if (block == nullptr) {
+      for (long long k = 0; k < num_nodes; ++k) integer();
+      continue;
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        num_nodes != block->num_nodes, std::runtime_error,
+        "Error! Element of type " << type << " with " << num_nodes
+                                  << " nodes in mesh file '" << fname_
+                                  << "'.\n");
+    for (int k = 0; k < block->num_nodes; ++k)
+      block->nodes.push_back(node(integer()));
+    block->tags.push_back(reg_phys);
+  }
+}
+
+}  // namespace
+
+void
+Albany::readGmshMesh(std::string const& fname, GmshMesh& mesh)
+{
+  int const fd = open(fname.c_str(), O_RDONLY);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      fd < 0, std::runtime_error,
+      "Error! Cannot open mesh file '" << fname << "'.\n");
+  struct stat st;
+  bool const stat_failed = fstat(fd, &st) != 0;
+  if (stat_failed) close(fd);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      stat_failed, std::runtime_error,
+      "Error! Cannot stat mesh file '" << fname << "'.\n");
+  std::size_t const size = st.st_size;
+
+  void* const addr =
+      size > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+  close(fd);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      addr == MAP_FAILED, std::runtime_error,
+      "Error! Cannot map mesh file '" << fname << "'.\n");
+  if (size > 0) madvise(addr, size, MADV_SEQUENTIAL);
+
+  char const* const begin = static_cast<char const*>(addr);
+  try {
+    GmshParser(fname, begin, begin + size, mesh).parse();
+  } catch (...) {
+    if (size > 0) munmap(addr, size);
+    throw;
+  }
+  if (size > 0) munmap(addr, size);
+}
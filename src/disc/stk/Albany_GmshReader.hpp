@@ -0,0 +1,73 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_GMSHREADER_HPP
+#define ALBANY_GMSHREADER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+/*!
+ * \brief Contents of a Gmsh mesh file, as needed by GmshSTKMeshStruct.
+ *
+ * Nodes are numbered 1..N in the order they appear in the file, and the
+ * connectivities use that numbering. Each element keeps a single tag: its
+ * physical tag in the legacy and 2.x formats; in the 4.x formats, the first
+ * physical tag of the entity it belongs to, or the entity tag if the entity
+ * has none.
+ */
+struct GmshMesh
+{
+  struct Elements
+  {
+    int              num_nodes;
+    std::vector<int> nodes;  // num_nodes entries per element
+    std::vector<int> tags;
+
+    std::size_t
+    size() const
+    {
+      return tags.size();
+    }
+  };
+
+  //! 1 for the legacy $NOD/$ELM format
+  double version{0.0};
+
+  bool binary{false};
+
+  //! Three coordinates per node
+  std::vector<double> coords;
+
+  Elements lines{2, {}, {}};
+  Elements trias{3, {}, {}};
+  Elements quads{4, {}, {}};
+  Elements tetra{4, {}, {}};
+  Elements hexas{8, {}, {}};
+
+  std::size_t
+  numNodes() const
+  {
+    return coords.size() / 3;
+  }
+};
+
+/*!
+ * \brief Reads a Gmsh mesh in the legacy, 2.x or 4.x format, ASCII or binary.
+ *
+ * The file is mapped in memory and parsed in a single pass, appending the
+ * nodes and elements to the arrays of \c mesh as they come. Binary 4.0 files
+ * are not supported (Gmsh has written 4.1 since version 4.1).
+ */
+void
+readGmshMesh(std::string const& fname, GmshMesh& mesh);
+
+}  // namespace Albany
+
+#endif  // ALBANY_GMSHREADER_HPP
@@ -38,44 +38,7 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
 
   if (commT->getRank() == 0)
   {
-    std::ifstream ifile;
-    ifile.open(fname.c_str());
-    if (!ifile.is_open())
-    {
-        TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
-    }
-
-    std::string line;
-    std::getline (ifile, line);
-
-    bool legacy = false;
-    bool binary = false;
-
-    if (line=="$NOD")
-    {
-      legacy = true;
-    }
-    else if (line=="$MeshFormat")
-    {
-      std::getline (ifile, line);
-      std::stringstream iss (line);
-
-      float version;
-      int doublesize;
-      iss >> version >> binary >> doublesize;
-    }
-    else
-    {
-      TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Mesh format not recognized.\n");
-    }
-    ifile.close();
-
-    if (legacy)
-      loadLegacyMesh (fname);
-    else if (binary)
-      loadBinaryMesh (fname);
-    else
-      loadAsciiMesh (fname);
+    loadMesh (fname);
   }
 
   // GenericSTKMeshStruct's constructor could not initialize metaData, cause the dimension was not set
@@ -200,24 +163,24 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
 
 Albany::GmshSTKMeshStruct::~GmshSTKMeshStruct()
 {
+  // Only proc 0 has loaded the file
   delete[] pts;
 
-  for (int i(0); i<5; ++i)
-    delete[] tetra[i];
-  for (int i(0); i<5; ++i)
-    delete[] trias[i];
-  for (int i(0); i<9; ++i)
-    delete[] hexas[i];
-  for (int i(0); i<5; ++i)
-    delete[] quads[i];
-  for (int i(0); i<3; ++i)
-    delete[] lines[i];
-
-  delete[] tetra;
-  delete[] trias;
-  delete[] hexas;
-  delete[] quads;
-  delete[] lines;
+  deleteElements (tetra, 4);
+  deleteElements (trias, 3);
+  deleteElements (hexas, 8);
+  deleteElements (quads, 4);
+  deleteElements (lines, 2);
+}
+
+void Albany::GmshSTKMeshStruct::deleteElements (int** rows, int num_nodes)
+{
+  if (rows==nullptr)
+    return;
+
+  for (int j(0); j<=num_nodes; ++j)
+    delete[] rows[j];
+  delete[] rows;
 }
 
 void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
@@ -346,99 +309,43 @@ Teuchos::RCP<const Teuchos::ParameterList> Albany::GmshSTKMeshStruct::getValidDi
 {
   Teuchos::RCP<Teuchos::ParameterList> validPL = this->getValidGenericSTKParameters("Valid ASCII_DiscParams");
   validPL->set<std::string>("Gmsh Input Mesh File Name", "mesh.msh",
-      "Name of the file containing the 2D mesh, with list of coordinates, elements' connectivity and boundary edges' connectivity");
+      "Name of the Gmsh mesh file, in the legacy, 2.x or 4.x format, ASCII or binary");
 
   return validPL;
 }
 
-// -------------------------------- Read methos ---------------------------- //
+// -------------------------------- Read methods --------------------------- //
 
-void Albany::GmshSTKMeshStruct::loadLegacyMesh (const std::string& fname)
+void Albany::GmshSTKMeshStruct::loadMesh (const std::string& fname)
 {
-  std::ifstream ifile;
-  ifile.open(fname.c_str());
-  if (!ifile.is_open())
-  {
-      TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
-  }
-
-  // Start reading nodes
-  std::string line;
-  while (std::getline (ifile, line) && line != "$NOD")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Nodes section not found.\n");
+  // Nodes and elements are stored in the order of the file, in one pass
+  GmshMesh mesh;
+  readGmshMesh (fname, mesh);
 
-  // Read the number of nodes
-  std::getline (ifile, line);
-  NumNodes = std::atoi (line.c_str() );
+  NumNodes = mesh.numNodes();
   TEUCHOS_TEST_FOR_EXCEPTION (NumNodes<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
   pts = new double [NumNodes][3];
+  for (int i(0); i<NumNodes; ++i)
+    for (int j(0); j<3; ++j)
+      pts[i][j] = mesh.coords[3*i+j];
 
-  // Read the nodes
-  int id;
-  for (int i=0; i<NumNodes; ++i)
-  {
-    ifile >> id >> pts[i][0] >> pts[i][1] >> pts[i][2];
-  }
-
-  // Start reading elements (cells and sides)
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$ELM")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found.\n");
-
-  // Read the number of entities
-  std::getline (ifile, line);
-  int num_entities = std::atoi (line.c_str() );
-  TEUCHOS_TEST_FOR_EXCEPTION (num_entities<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
-
-  // Gmsh lists elements and sides (and some points) all toghether, and does not specify beforehand what kind of elements
-  // the mesh has. Hence, we need to scan the entity list once to establish what kind of elements we have. We support
-  // linear Tetrahedra/Hexahedra in 3D and linear Triangle/Quads in 2D
-
-  int nb_tetra(0), nb_hexa(0), nb_tria(0), nb_quad(0), nb_line(0), e_type(0);
-  for (int i(0); i<num_entities; ++i)
-  {
-    std::getline(ifile,line);
-    std::stringstream ss(line);
-    ss >> id >> e_type;
-
-    switch (e_type)
-    {
-      case 1: ++nb_line;  break;
-      case 2: ++nb_tria;  break;
-      case 3: ++nb_quad;  break;
-      case 4: ++nb_tetra; break;
-      case 5: ++nb_hexa;  break;
-      case 15: /*point*/  break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
-    }
-  }
+  // We support linear Tetrahedra/Hexahedra in 3D and linear Triangle/Quads in 2D
+  int nb_tetra = mesh.tetra.size();
+  int nb_hexa  = mesh.hexas.size();
+  int nb_tria  = mesh.trias.size();
+  int nb_quad  = mesh.quads.size();
+  int nb_line  = mesh.lines.size();
 
   TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra*nb_hexa!=0, std::logic_error, "Error! Cannot mix tetrahedra and hexahedra.\n");
   TEUCHOS_TEST_FOR_EXCEPTION (nb_tria*nb_quad!=0, std::logic_error, "Error! Cannot mix triangles and quadrilaterals.\n");
   TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra+nb_hexa+nb_tria+nb_quad==0, std::logic_error, "Error! Can only handle 2D and 3D geometries.\n");
 
-  lines = new int*[3];
-  tetra = new int*[5];
-  trias = new int*[4];
-  hexas = new int*[9];
-  quads = new int*[5];
-  for (int i(0); i<5; ++i)
-    tetra[i] = new int[nb_tetra];
-  for (int i(0); i<5; ++i)
-    trias[i] = new int[nb_tria];
-  for (int i(0); i<9; ++i)
-    hexas[i] = new int[nb_hexa];
-  for (int i(0); i<5; ++i)
-    quads[i] = new int[nb_quad];
-  for (int i(0); i<3; ++i)
-    lines[i] = new int[nb_line];
+  // Each array has one row per element node, plus a last row with the tag
+  lines = copyElements (mesh.lines);
+  tetra = copyElements (mesh.tetra);
+  trias = copyElements (mesh.trias);
+  hexas = copyElements (mesh.hexas);
+  quads = copyElements (mesh.quads);
 
   if (nb_tetra>0)
   {
@@ -484,534 +391,20 @@ void Albany::GmshSTKMeshStruct::loadLegacyMesh (const std::string& fname)
     elems = quads;
     sides = lines;
   }
-
-  // Reset the stream to the beginning of the element section
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$ELM")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found; however, it was found earlier. This may be a bug.\n");
-  std::getline(ifile,line); // Skip line with number of elements
-
-  // Read the elements
-  int reg_phys, reg_elem, n_nodes;
-  int iline(0), itria(0), iquad(0), itetra(0), ihexa(0);
-  for (int i(0); i<num_entities; ++i)
-  {
-    std::getline(ifile,line);
-    std::stringstream ss(line);
-    ss >> id >> e_type >> reg_phys >> reg_elem >> n_nodes;
-    switch (e_type)
-    {
-      case 1: // 2-pt Line
-        ss >> lines[0][iline] >> lines[1][iline];
-        lines[2][iline] = reg_phys;
-        ++iline;
-        break;
-      case 2: // 3-pt Triangle
-        ss >> trias[0][itria] >> trias[1][itria] >> trias[2][itria];
-        trias[4][itria] = reg_phys;
-        ++itria;
-        break;
-      case 3: // 4-pt Quad
-        ss >> quads[0][iquad] >> quads[1][iquad] >> quads[2][iquad] >> quads[3][iquad];
-        quads[4][iquad] = reg_phys;
-        ++iquad;
-        break;
-      case 4: // 4-pt Tetra
-        ss >> tetra[0][itetra] >> tetra[1][itetra] >> tetra[2][itetra] >> tetra[3][itetra];
-        trias[4][itetra] = reg_phys;
-        ++itria;
-        break;
-      case 5: // 8-pt Hexa
-        ss >> hexas[0][ihexa] >> hexas[1][ihexa] >> hexas[2][ihexa] >> hexas[3][ihexa]
-           >> hexas[4][ihexa] >> hexas[5][ihexa] >> hexas[6][ihexa] >> hexas[7][ihexa];
-        hexas[8][ihexa] = reg_phys;
-        ++ihexa;
-        break;
-      case 15: // Point
-          break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported; but you should have got an error before!\n");
-    }
-  }
-
-  // Close the input stream
-  ifile.close();
 }
 
-void Albany::GmshSTKMeshStruct::loadAsciiMesh (const std::string& fname)
+int** Albany::GmshSTKMeshStruct::copyElements (const GmshMesh::Elements& e)
 {
-  std::ifstream ifile;
-  ifile.open(fname.c_str());
-  if (!ifile.is_open())
-  {
-      TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
-  }
-
-  // Start reading nodes
-  std::string line;
-  while (std::getline (ifile, line) && line != "$Nodes")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Nodes section not found.\n");
-
-  // Read the number of nodes
-  std::getline (ifile, line);
-  NumNodes = std::atoi (line.c_str() );
-  TEUCHOS_TEST_FOR_EXCEPTION (NumNodes<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
-  pts = new double [NumNodes][3];
-
-  // Read the nodes
-  int id;
-  for (int i=0; i<NumNodes; ++i)
-  {
-    ifile >> id >> pts[i][0] >> pts[i][1] >> pts[i][2];
-  }
-
-  // Start reading elements (cells and sides)
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$Elements")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found.\n");
-
-  // Read the number of entities
-  std::getline (ifile, line);
-  int num_entities = std::atoi (line.c_str() );
-  TEUCHOS_TEST_FOR_EXCEPTION (num_entities<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
-
-  // Gmsh lists elements and sides (and some points) all toghether, and does not specify beforehand what kind of elements
-  // the mesh has. Hence, we need to scan the entity list once to establish what kind of elements we have. We support
-  // linear Tetrahedra/Hexahedra in 3D and linear Triangle/Quads in 2D
-
-  int nb_tetra(0), nb_hexa(0), nb_tria(0), nb_quad(0), nb_line(0), e_type(0);
-  for (int i(0); i<num_entities; ++i)
-  {
-    std::getline(ifile,line);
-    std::stringstream ss(line);
-    ss >> id >> e_type;
-
-    switch (e_type)
-    {
-      case 1: ++nb_line;  break;
-      case 2: ++nb_tria;  break;
-      case 3: ++nb_quad;  break;
-      case 4: ++nb_tetra; break;
-      case 5: ++nb_hexa;  break;
-      case 15: /*point*/  break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
-    }
-  }
-
-  TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra*nb_hexa!=0, std::logic_error, "Error! Cannot mix tetrahedra and hexahedra.\n");
-  TEUCHOS_TEST_FOR_EXCEPTION (nb_tria*nb_quad!=0, std::logic_error, "Error! Cannot mix triangles and quadrilaterals.\n");
-  TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra+nb_hexa+nb_tria+nb_quad==0, std::logic_error, "Error! Can only handle 2D and 3D geometries.\n");
-
-  lines = new int*[3];
-  tetra = new int*[5];
-  trias = new int*[4];
-  hexas = new int*[9];
-  quads = new int*[5];
-  for (int i(0); i<5; ++i)
-    tetra[i] = new int[nb_tetra];
-  for (int i(0); i<5; ++i)
-    trias[i] = new int[nb_tria];
-  for (int i(0); i<9; ++i)
-    hexas[i] = new int[nb_hexa];
-  for (int i(0); i<5; ++i)
-    quads[i] = new int[nb_quad];
-  for (int i(0); i<3; ++i)
-    lines[i] = new int[nb_line];
-
-  if (nb_tetra>0)
-  {
-    this->numDim = 3;
-
-    NumElems = nb_tetra;
-    NumSides = nb_tria;
-    NumElemNodes = 4;
-    NumSideNodes = 3;
-    elems = tetra;
-    sides = trias;
-  }
-  else if (nb_hexa>0)
-  {
-    this->numDim = 3;
-
-    NumElems = nb_hexa;
-    NumSides = nb_quad;
-    NumElemNodes = 8;
-    NumSideNodes = 4;
-    elems = hexas;
-    sides = quads;
-  }
-  else if (nb_tria>0)
-  {
-    this->numDim = 2;
-
-    NumElems = nb_tria;
-    NumSides = nb_line;
-    NumElemNodes = 3;
-    NumSideNodes = 2;
-    elems = trias;
-    sides = lines;
-  }
-  else
-  {
-    this->numDim = 2;
-
-    NumElems = nb_quad;
-    NumSides = nb_line;
-    NumElemNodes = 4;
-    NumSideNodes = 2;
-    elems = quads;
-    sides = lines;
-  }
-
-  // Reset the stream to the beginning of the element section
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$Elements")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found; however, it was found earlier. This may be a bug.\n");
-  std::getline(ifile,line); // Skip line with number of elements
-
-  // Read the elements
-  int iline(0), itria(0), iquad(0), itetra(0), ihexa(0), n_tags(0);
-  std::vector<int> tags;
-  for (int i(0); i<num_entities; ++i)
-  {
-    std::getline(ifile,line);
-    std::stringstream ss(line);
-    ss >> id >> e_type >> n_tags;
-    TEUCHOS_TEST_FOR_EXCEPTION (n_tags<=0, Teuchos::Exceptions::InvalidParameter, "Error! Number of tags must be positive.\n");
-    tags.resize(n_tags+1);
-    for (int j(0); j<n_tags; ++j)
-      ss >> tags[j];
-    tags[n_tags] = 0;
-
-    switch (e_type)
-    {
-      case 1: // 2-pt Line
-        ss >> lines[0][iline] >> lines[1][iline];
-        lines[2][iline] = tags[0];
-        ++iline;
-        break;
-      case 2: // 3-pt Triangle
-        ss >> trias[0][itria] >> trias[1][itria] >> trias[2][itria];
-        trias[4][itria] = tags[0];
-        ++itria;
-        break;
-      case 3: // 4-pt Quad
-        ss >> quads[0][iquad] >> quads[1][iquad] >> quads[2][iquad] >> quads[3][iquad];
-        quads[4][iquad] = tags[0];
-        ++iquad;
-        break;
-      case 4: // 4-pt Tetra
-        ss >> tetra[0][itetra] >> tetra[1][itetra] >> tetra[2][itetra] >> tetra[3][itetra];
-        trias[4][itetra] = tags[0];
-        ++itria;
-        break;
-      case 5: // 8-pt Hexa
-        ss >> hexas[0][ihexa] >> hexas[1][ihexa] >> hexas[2][ihexa] >> hexas[3][ihexa]
-           >> hexas[4][ihexa] >> hexas[5][ihexa] >> hexas[6][ihexa] >> hexas[7][ihexa];
-        hexas[8][ihexa] = tags[0];
-        ++ihexa;
-        break;
-      case 15: // Point
-          break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported; but you should have got an error before!\n");
-    }
-  }
-
-  // Close the input stream
-  ifile.close();
-}
-
-void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
-{
-  std::ifstream ifile;
-  ifile.open(fname.c_str());
-  if (!ifile.is_open())
-  {
-      TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
-  }
-
-  std::string line;
-  std::getline (ifile, line); // $MeshFormat
-  std::getline (ifile, line); // 2.0 file-type data-size
-
-  // Check file endianness
-  union
-  {
-    int i;
-    char c[sizeof (int)];
-  } one;
-
-  ifile.read (one.c, sizeof (int) );
-  TEUCHOS_TEST_FOR_EXCEPTION (one.i!=1, std::runtime_error, "Error! Uncompatible binary format.\n");
-
-  // Start reading nodes
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$Nodes")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Nodes section not found.\n");
-
-  // Read the number of nodes
-  std::getline (ifile, line);
-  NumNodes = std::atoi (line.c_str() );
-  TEUCHOS_TEST_FOR_EXCEPTION (NumNodes<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
-  pts = new double[NumNodes][3];
-
-  // Read the nodes
-  int id;
-  for (int i=0; i<NumNodes; ++i)
-  {
-    ifile.read (reinterpret_cast<char*> (&id), sizeof (int) );
-    ifile.read (reinterpret_cast<char*> (pts[i]), 3 * sizeof (double) );
-  }
-
-  // Start reading elements (cells and sides)
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$Elements")
-  {
-    // Keep swallowing lines...
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found.\n");
-
-  // Read the number of entities
-  std::getline (ifile, line);
-  int num_entities = std::atoi (line.c_str() );
-  TEUCHOS_TEST_FOR_EXCEPTION (num_entities<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
-
-  // Gmsh lists elements and sides (and some points) all toghether, and does not specify beforehand what kind of elements
-  // the mesh has. Hence, we need to scan the entity list once to establish what kind of elements we have. We support
-  // linear Tetrahedra/Hexahedra in 3D and linear Triangle/Quads in 2D
-  std::vector<int> tmp;
-  int nb_tetra(0), nb_hexa(0), nb_tria(0), nb_quad(0), nb_line(0), n_tags(0), e_type(0), entities_found(0);
-  while (entities_found<num_entities)
-  {
-    int header[3];
-    ifile.read(reinterpret_cast<char*> (header), 3*sizeof(int));
-
-    TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, std::logic_error, "Error! Invalid number of elements of this type.\n");
-    TEUCHOS_TEST_FOR_EXCEPTION (header[2]<=0, std::logic_error, "Error! Invalid number of tags.\n");
-
-    e_type = header[0];
-    entities_found += header[1];
-    n_tags = header[2];
-
-    int length;
-    switch (e_type)
-    {
-      case 1: // 2-pt Line
-        length = 1+n_tags+2; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_line += header[1];
-        break;
-      case 2: // 3-pt Triangle
-        length = 1+n_tags+3; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_tria += header[1];
-        break;
-      case 3: // 4-pt Quad
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_quad += header[1];
-        break;
-      case 4: // 4-pt Tetra
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_quad += header[1];
-        break;
-      case 5: // 8-pt Hexa
-        length = 1+n_tags+8; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_quad += header[1];
-        break;
-      case 15: // Point
-        break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
-    }
-  }
-  TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra*nb_hexa!=0, std::logic_error, "Error! Cannot mix tetrahedra and hexahedra.\n");
-  TEUCHOS_TEST_FOR_EXCEPTION (nb_tria*nb_quad!=0, std::logic_error, "Error! Cannot mix triangles and quadrilaterals.\n");
-  TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra+nb_hexa+nb_tria+nb_quad==0, std::logic_error, "Error! Can only handle 2D and 3D geometries.\n");
-
-  lines = new int*[3];
-  tetra = new int*[5];
-  trias = new int*[4];
-  hexas = new int*[9];
-  quads = new int*[5];
-  for (int i(0); i<5; ++i)
-    tetra[i] = new int[nb_tetra];
-  for (int i(0); i<5; ++i)
-    trias[i] = new int[nb_tria];
-  for (int i(0); i<9; ++i)
-    hexas[i] = new int[nb_hexa];
-  for (int i(0); i<5; ++i)
-    quads[i] = new int[nb_quad];
-  for (int i(0); i<3; ++i)
-    lines[i] = new int[nb_line];
-
-  if (nb_tetra>0)
-  {
-    this->numDim = 3;
-
-    NumElems = nb_tetra;
-    NumSides = nb_tria;
-    NumElemNodes = 4;
-    NumSideNodes = 3;
-    elems = tetra;
-    sides = trias;
-  }
-  else if (nb_hexa>0)
-  {
-    this->numDim = 3;
-
-    NumElems = nb_hexa;
-    NumSides = nb_quad;
-    NumElemNodes = 8;
-    NumSideNodes = 4;
-    elems = hexas;
-    sides = quads;
-  }
-  else if (nb_tria>0)
-  {
-    this->numDim = 2;
-
-    NumElems = nb_tria;
-    NumSides = nb_line;
-    NumElemNodes = 3;
-    NumSideNodes = 2;
-    elems = trias;
-    sides = lines;
-  }
-  else
-  {
-    this->numDim = 2;
-
-    NumElems = nb_quad;
-    NumSides = nb_line;
-    NumElemNodes = 4;
-    NumSideNodes = 2;
-    elems = quads;
-    sides = lines;
-  }
-
-  // Reset the stream to the beginning of the element section
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$Elements")
-  {
-    // Keep swallowing lines...
-  }
-  std::getline(ifile,line); // Skip line with number of elements
-
-  entities_found = 0;
-  int iline(0), itria(0), iquad(0), itetra(0), ihexa(0);
-  while (entities_found<num_entities)
-  {
-    int header[3];
-    ifile.read(reinterpret_cast<char*> (header), 3*sizeof(int));
-
-    TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, std::logic_error, "Error! Invalid number of elements of this type.\n");
-    TEUCHOS_TEST_FOR_EXCEPTION (header[2]<=0, std::logic_error, "Error! Invalid number of tags.\n");
-
-    e_type = header[0];
-    entities_found += header[1];
-    n_tags = header[2];
-
-    int length;
-    switch (e_type)
-    {
-      case 1: // 2-pt Line
-        length = 1+n_tags+2; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++iline)
-        {
-          lines[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          lines[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          lines[2][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 2: // 3-pt Triangle
-        length = 1+n_tags+3; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++itria)
-        {
-          trias[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          trias[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          trias[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          trias[3][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 3: // 4-pt Quad
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++iquad)
-        {
-          quads[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          quads[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          quads[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          quads[3][j] = tmp[sizeof(int)*(j*length+1+n_tags+3)];
-          quads[4][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 4: // 4-pt Tetra
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++itetra)
-        {
-          tetra[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          tetra[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          tetra[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          tetra[3][j] = tmp[sizeof(int)*(j*length+1+n_tags+3)];
-          tetra[4][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 5: // 8-pt Hexa
-        length = 1+n_tags+8; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++ihexa)
-        {
-          hexas[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          hexas[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          hexas[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          hexas[3][j] = tmp[sizeof(int)*(j*length+1+n_tags+3)];
-          hexas[4][j] = tmp[sizeof(int)*(j*length+1+n_tags+4)];
-          hexas[5][j] = tmp[sizeof(int)*(j*length+1+n_tags+5)];
-          hexas[6][j] = tmp[sizeof(int)*(j*length+1+n_tags+6)];
-          hexas[7][j] = tmp[sizeof(int)*(j*length+1+n_tags+7)];
-          hexas[8][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 15: // Point
-        break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
-    }
-  }
-
-  // Close the input stream
-  ifile.close();
+  const int n  = e.size();
+  const int nn = e.num_nodes;
+  int** rows = new int*[nn+1];
+  for (int j(0); j<=nn; ++j)
+    rows[j] = new int[n];
+  for (int i(0); i<n; ++i)
+  {
+    for (int j(0); j<nn; ++j)
+      rows[j][i] = e.nodes[i*nn+j];
+    rows[nn][i] = e.tags[i];
+  }
+  return rows;
 }
@@ -6,6 +6,7 @@
 #define ALBANY_GMSH_STK_MESH_STRUCT_HPP
 
 #include "Albany_GenericSTKMeshStruct.hpp"
+#include "Albany_GmshReader.hpp"
 
 //#include <Ionit_Initializer.h>
 
@@ -40,9 +41,9 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
 
   Teuchos::RCP<const Teuchos::ParameterList> getValidDiscretizationParameters() const;
 
-  void loadLegacyMesh (const std::string& fname);
-  void loadAsciiMesh (const std::string& fname);
-  void loadBinaryMesh (const std::string& fname);
+  void loadMesh (const std::string& fname);
+  static int** copyElements (const GmshMesh::Elements& e);
+  static void deleteElements (int** rows, int num_nodes);
 
   int NumElemNodes; // Number of nodes per element (e.g. 3 for Triangles)
   int NumSideNodes; // Number of nodes per side (e.g. 2 for a Line)
@@ -52,14 +53,14 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
 
   std::map<int,std::string> bdTagToNodeSetName;
   std::map<int,std::string> bdTagToSideSetName;
-  double (*pts)[3];
+  double (*pts)[3] = nullptr;
 
   // Only some will be used, but it's easier to have different pointers
-  int** hexas;
-  int** tetra;
-  int** quads;
-  int** trias;
-  int** lines;
+  int** hexas = nullptr;
+  int** tetra = nullptr;
+  int** quads = nullptr;
+  int** trias = nullptr;
+  int** lines = nullptr;
 
   // These pointers will be set equal to two of the previous group, depending on dimension
   // NOTE: do not call delete on these pointers! Delete the previous ones only!
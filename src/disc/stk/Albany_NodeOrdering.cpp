@@ -0,0 +1,149 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_NodeOrdering.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+namespace Albany {
+
+std::vector<int>
+reverseCuthillMcKee(
+    std::vector<int> const& offsets,
+    std::vector<int> const& adjacency)
+{
+  int const num_vertices = offsets.size() - 1;
+
+  std::vector<int> degree(num_vertices);
+  for (int i = 0; i < num_vertices; ++i)
+    degree[i] = offsets[i + 1] - offsets[i];
+
+  // Candidate start vertices, by increasing degree
+  std::vector<int> by_degree(num_vertices);
+  std::iota(by_degree.begin(), by_degree.end(), 0);
+  std::stable_sort(by_degree.begin(), by_degree.end(), [&](int a, int b) {
+    return degree[a] < degree[b];
+  });
+
+  std::vector<int>  order;
+  std::vector<char> visited(num_vertices, 0);
+  std::vector<int>  neighbors;
+  order.reserve(num_vertices);
+
+  for (int start : by_degree) {
+    if (visited[start]) continue;
+
+    // Breadth-first search, visiting neighbors by increasing degree
+    std::size_t head = order.size();
+    order.push_back(start);
+    visited[start] = 1;
+    while (head < order.size()) {
+      int const v = order[head++];
+      neighbors.clear();
+      for (int k = offsets[v]; k < offsets[v + 1]; ++k) {
+        int const w = adjacency[k];
+        if (!visited[w]) {
+          visited[w] = 1;
+          neighbors.push_back(w);
+        }
+      }
+      std::stable_sort(neighbors.begin(), neighbors.end(), [&](int a, int b) {
+        return degree[a] < degree[b];
+      });
+      order.insert(order.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+namespace {
+
+// Position of a point with integer coordinates x[0..dim) of the given
+// number of bits along the Hilbert curve (J. Skilling, "Programming the
+// Hilbert curve", AIP Conf. Proc. 707, 2004).
+std::uint64_t
+hilbertIndex(std::uint32_t* x, int const dim, int const bits)
+{
+  std::uint32_t const m = std::uint32_t(1) << (bits - 1);
+
+  // Inverse undo
+  for (std::uint32_t q = m; q > 1; q >>= 1) {
+    std::uint32_t const p = q - 1;
+    for (int i = 0; i < dim; ++i) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        std::uint32_t const t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < dim; ++i) x[i] ^= x[i - 1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = m; q > 1; q >>= 1)
+    if (x[dim - 1] & q) t ^= q - 1;
+  for (int i = 0; i < dim; ++i) x[i] ^= t;
+
+  // Interleave the transposed index
+  std::uint64_t index = 0;
+  for (int b = bits - 1; b >= 0; --b)
+    for (int i = 0; i < dim; ++i) index = (index << 1) | ((x[i] >> b) & 1);
+  return index;
+}
+
+}  // namespace
+
+std::vector<int>
+hilbertOrder(std::vector<double> const& coords, int const dim)
+{
+  int const num_points = coords.size() / dim;
+
+  // At most 63 bits of index in all
+  int const bits = std::min(63 / dim, 31);
+
+  double lo[3], hi[3];
+  for (int i = 0; i < dim; ++i) {
+    lo[i] = std::numeric_limits<double>::max();
+    hi[i] = std::numeric_limits<double>::lowest();
+  }
+  for (int n = 0; n < num_points; ++n) {
+    for (int i = 0; i < dim; ++i) {
+      lo[i] = std::min(lo[i], coords[n * dim + i]);
+      hi[i] = std::max(hi[i], coords[n * dim + i]);
+    }
+  }
+
+  // Same scale in all directions, so that the curve follows the geometry
+  double extent = 0.0;
+  for (int i = 0; i < dim; ++i) extent = std::max(extent, hi[i] - lo[i]);
+  double const max_int = double((std::uint64_t(1) << bits) - 1);
+  double const scale   = extent > 0.0 ? max_int / extent : 0.0;
+
+  std::vector<std::uint64_t> index(num_points);
+  for (int n = 0; n < num_points; ++n) {
+    std::uint32_t x[3];
+    for (int i = 0; i < dim; ++i)
+      x[i] = std::uint32_t((coords[n * dim + i] - lo[i]) * scale);
+    index[n] = dim == 1 ? x[0] : hilbertIndex(x, dim, bits);
+  }
+
+  std::vector<int> order(num_points);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return index[a] < index[b];
+  });
+  return order;
+}
+
+}  // namespace Albany
@@ -0,0 +1,37 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_NODEORDERING_HPP
+#define ALBANY_NODEORDERING_HPP
+
+#include <vector>
+
+namespace Albany {
+
+/*!
+ * \brief Locality-improving orderings of mesh vertices
+ *
+ * Both functions return a permutation \c order of the vertices, where
+ * \c order[k] is the vertex placed at position k.
+ */
+
+//! Reverse Cuthill-McKee ordering of a graph given in compressed row form:
+//! the neighbors of vertex i are adjacency[offsets[i]] up to
+//! adjacency[offsets[i+1]]. Each connected component is started from one of
+//! its vertices of minimum degree.
+std::vector<int>
+reverseCuthillMcKee(
+    std::vector<int> const& offsets,
+    std::vector<int> const& adjacency);
+
+//! Order of points along a Hilbert curve through their bounding box.
+//! coords holds dim (1 to 3) interleaved coordinates per point.
+std::vector<int>
+hilbertOrder(std::vector<double> const& coords, int dim);
+
+}  // namespace Albany
+
+#endif  // ALBANY_NODEORDERING_HPP
@@ -8,6 +8,7 @@
 
 #include "Albany_BucketArray.hpp"
 #include "Albany_NodalGraphUtils.hpp"
+#include "Albany_NodeOrdering.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_Utils.hpp"
@@ -16,8 +17,11 @@
 #include "Albany_ContactManager.hpp"
 #endif
 
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <set>
 #include <string>
 
 #include <Shards_BasicTopologies.hpp>
@@ -35,6 +39,8 @@
 
 #include <PHAL_Dimension.hpp>
 
+#include <Teuchos_TimeMonitor.hpp>
+
 #include <stk_mesh/base/FEMHelpers.hpp>
 
 #ifdef ALBANY_SEACAS
@@ -98,6 +104,11 @@ Albany::STKDiscretization::STKDiscretization(
 Albany::STKDiscretization::~STKDiscretization()
 {
 #ifdef ALBANY_SEACAS
+  // Finish pending output before the exodus file is closed
+  output_queue_ = Teuchos::null;
+
+  std::lock_guard<std::mutex> lock(fileIoMutex());
+  mesh_data = Teuchos::null;
   if (stkMeshStruct->cdfOutput) {
     if (netCDFp) {
       const int ierr = nc_close(netCDFp);
@@ -916,9 +927,13 @@ Albany::STKDiscretization::writeSolutionToFileT(
 
     container->transferSolutionToCoords();
 
+    // The worksets' coordinates point into the coordinates field
+    ++mesh_version_;
+
     if (!mesh_data.is_null()) {
       // Mesh coordinates have changed. Rewrite output file by deleting the mesh
       // data object and recreate it
+      flushExodusOutput();
       setupExodusOutput();
     }
   }
@@ -928,17 +943,7 @@ Albany::STKDiscretization::writeSolutionToFileT(
       !(outputInterval % stkMeshStruct->exoOutputInterval)) {
     double time_label = monotonicTimeLabel(time);
 
-    mesh_data->begin_output_step(outputFileIdx, time_label);
-    int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-    // Writing mesh global variables
-    for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates()) {
-      mesh_data->write_global(outputFileIdx, it.first, it.second);
-    }
-    for (auto& it :
-         stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates()) {
-      mesh_data->write_global(outputFileIdx, it.first, it.second);
-    }
-    mesh_data->end_output_step(outputFileIdx);
+    int out_step = writeExodusOutputStep(time_label);
 
     if (mapT->getComm()->getRank() == 0) {
       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
@@ -951,7 +956,11 @@ Albany::STKDiscretization::writeSolutionToFileT(
       !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
     double time_label = monotonicTimeLabel(time);
 
-    const int out_step = processNetCDFOutputRequestT(solnT);
+    int out_step;
+    {
+      std::lock_guard<std::mutex> lock(fileIoMutex());
+      out_step = processNetCDFOutputRequestT(solnT);
+    }
 
     if (mapT->getComm()->getRank() == 0) {
       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
@@ -992,9 +1001,13 @@ Albany::STKDiscretization::writeSolutionMVToFile(
 
     container->transferSolutionToCoords();
 
+    // The worksets' coordinates point into the coordinates field
+    ++mesh_version_;
+
     if (!mesh_data.is_null()) {
       // Mesh coordinates have changed. Rewrite output file by deleting the mesh
       // data object and recreate it
+      flushExodusOutput();
       setupExodusOutput();
     }
   }
@@ -1004,17 +1017,7 @@ Albany::STKDiscretization::writeSolutionMVToFile(
       !(outputInterval % stkMeshStruct->exoOutputInterval)) {
     double time_label = monotonicTimeLabel(time);
 
-    mesh_data->begin_output_step(outputFileIdx, time_label);
-    int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-    // Writing mesh global variables
-    for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates()) {
-      mesh_data->write_global(outputFileIdx, it.first, it.second);
-    }
-    for (auto& it :
-         stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates()) {
-      mesh_data->write_global(outputFileIdx, it.first, it.second);
-    }
-    mesh_data->end_output_step(outputFileIdx);
+    int out_step = writeExodusOutputStep(time_label);
 
     if (mapT->getComm()->getRank() == 0) {
       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
@@ -1027,7 +1030,11 @@ Albany::STKDiscretization::writeSolutionMVToFile(
       !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
     double time_label = monotonicTimeLabel(time);
 
-    const int out_step = processNetCDFOutputRequestMV(solnT);
+    int out_step;
+    {
+      std::lock_guard<std::mutex> lock(fileIoMutex());
+      out_step = processNetCDFOutputRequestMV(solnT);
+    }
 
     if (mapT->getComm()->getRank() == 0) {
       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
@@ -1524,6 +1531,94 @@ Albany::STKDiscretization::nonzeroesPerRow(const int neq) const
   return estNonzeroesPerRow;
 }
 
+void
+Albany::STKDiscretization::computeNodeOrdering()
+{
+  node_order_.clear();
+
+  const std::string& ordering = stkMeshStruct->nodeOrdering;
+  if (ordering.empty() || ordering == "None") return;
+
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: Node Ordering");
+
+  // All overlap nodes are ordered; owned and part maps follow the same order
+  stk::mesh::Selector select_overlap =
+      metaData.locally_owned_part() | metaData.globally_shared_part();
+  std::vector<stk::mesh::Entity> nodes;
+  stk::mesh::get_selected_entities(
+      select_overlap, bulkData.buckets(stk::topology::NODE_RANK), nodes);
+  const int numNodes = nodes.size();
+
+  std::vector<int> order;
+  if (ordering == "Reverse Cuthill-McKee") {
+    std::unordered_map<GO, int> index;
+    index.reserve(numNodes);
+    for (int i = 0; i < numNodes; ++i) index[gid(nodes[i])] = i;
+
+    // Nodal graph: nodes sharing an element are adjacent
+    std::vector<int> offsets(1, 0), adjacency, row;
+    for (int i = 0; i < numNodes; ++i) {
+      row.clear();
+      stk::mesh::Entity const* elems = bulkData.begin_elements(nodes[i]);
+      const int num_elems = bulkData.num_elements(nodes[i]);
+      for (int e = 0; e < num_elems; ++e) {
+        stk::mesh::Entity const* elem_nodes = bulkData.begin_nodes(elems[e]);
+        const int num_elem_nodes = bulkData.num_nodes(elems[e]);
+        for (int k = 0; k < num_elem_nodes; ++k) {
+          auto it = index.find(gid(elem_nodes[k]));
+          if (it != index.end() && it->second != i) row.push_back(it->second);
+        }
+      }
+      std::sort(row.begin(), row.end());
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+      adjacency.insert(adjacency.end(), row.begin(), row.end());
+      offsets.push_back(adjacency.size());
+    }
+    order = reverseCuthillMcKee(offsets, adjacency);
+  } else if (ordering == "Hilbert") {
+    AbstractSTKFieldContainer::VectorFieldType* coordinates_field =
+        stkMeshStruct->getCoordinatesField();
+    const int numDim = stkMeshStruct->numDim;
+
+    std::vector<double> xyz(numNodes * numDim);
+    for (int i = 0; i < numNodes; ++i) {
+      const double* x = stk::mesh::field_data(*coordinates_field, nodes[i]);
+      for (int d = 0; d < numDim; ++d) xyz[i * numDim + d] = x[d];
+    }
+    order = hilbertOrder(xyz, numDim);
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true,
+        std::logic_error,
+        "Albany::STKDiscretization: unknown Node Ordering " << ordering
+            << ", use None, Reverse Cuthill-McKee or Hilbert\n");
+  }
+
+  node_order_.reserve(numNodes);
+  for (int k = 0; k < numNodes; ++k) node_order_[gid(nodes[order[k]])] = k;
+}
+
+void
+Albany::STKDiscretization::sortByNodeOrder(
+    std::vector<stk::mesh::Entity>& nodes) const
+{
+  if (node_order_.empty()) return;
+
+  std::vector<std::pair<int, stk::mesh::Entity>> keyed(nodes.size());
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+    keyed[i] = std::make_pair(node_order_.at(gid(nodes[i])), nodes[i]);
+
+  std::sort(
+      keyed.begin(),
+      keyed.end(),
+      [](const std::pair<int, stk::mesh::Entity>& a,
+         const std::pair<int, stk::mesh::Entity>& b) {
+        return a.first < b.first;
+      });
+
+  for (std::size_t i = 0; i < nodes.size(); ++i) nodes[i] = keyed[i].second;
+}
+
 void
 Albany::STKDiscretization::computeNodalMaps(bool overlapped)
 {
@@ -1571,6 +1666,7 @@ Albany::STKDiscretization::computeNodalMaps(bool overlapped)
 
     stk::mesh::get_selected_entities(
         selector, bulkData.buckets(stk::topology::NODE_RANK), nodes);
+    sortByNodeOrder(nodes);
 
     numNodes = nodes.size();
 
@@ -1616,6 +1712,7 @@ Albany::STKDiscretization::computeOwnedNodesAndUnknowns()
       select_owned_in_part,
       bulkData.buckets(stk::topology::NODE_RANK),
       ownednodes);
+  sortByNodeOrder(ownednodes);
 
   numOwnedNodes = ownednodes.size();
   node_mapT     = nodalDOFsStructContainer.getDOFsStruct("mesh_nodes").map;
@@ -1646,6 +1743,7 @@ Albany::STKDiscretization::computeOverlapNodesAndUnknowns()
       select_overlap_in_part,
       bulkData.buckets(stk::topology::NODE_RANK),
       overlapnodes);
+  sortByNodeOrder(overlapnodes);
 
   numOverlapNodes = overlapnodes.size();
   numOverlapNodes = overlapnodes.size();
@@ -1670,6 +1768,7 @@ Albany::STKDiscretization::computeOverlapNodesAndUnknowns()
 void
 Albany::STKDiscretization::computeGraphs()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: Jacobian Graph");
   computeGraphsUpToFillComplete();
   fillCompleteGraphs();
 }
@@ -1684,6 +1783,9 @@ Albany::STKDiscretization::computeGraphsUpToFillComplete()
   // Loads member data:  overlap_graph, numOverlapodes, overlap_node_map,
   // coordinates, graphs
 
+  // Symbolic setup done on the previous graph is now stale.
+  ++graph_version_;
+
   overlap_graphT =
       Teuchos::null;  // delete existing graph happens here on remesh
 
@@ -1702,9 +1804,14 @@ Albany::STKDiscretization::computeGraphsUpToFillComplete()
   if (commT->getRank() == 0)
     *out << "STKDisc: " << cells.size() << " elements on Proc 0 " << std::endl;
 
-  Tpetra_GO                     row, col;
+  Tpetra_GO                     row;
   Teuchos::ArrayView<Tpetra_GO> colAV;
 
+  // Column indices of all the dofs of one element (or side). They are
+  // gathered once per element and inserted as whole rows, rather than
+  // one index at a time.
+  std::vector<Tpetra_GO> cols;
+
   // determining the equations that are defined on the whole domain
   std::vector<int> globalEqns;
   for (int k(0); k < neq; ++k) {
@@ -1718,24 +1825,24 @@ Albany::STKDiscretization::computeGraphsUpToFillComplete()
     stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
     const size_t             num_nodes = bulkData.num_nodes(e);
 
+    // Note: here we cycle through ALL the eqns (not just the global ones),
+    //       since they could all be coupled with the row eq
+    cols.resize(num_nodes * neq);
+    for (std::size_t l = 0; l < num_nodes; l++) {
+      const GO colNodeGID = gid(node_rels[l]);
+      for (std::size_t m = 0; m < neq; m++)
+        cols[l * neq + m] = getGlobalDOF(colNodeGID, m);
+    }
+    colAV = Teuchos::arrayView(cols.data(), cols.size());
+
     // loop over local nodes
     for (std::size_t j = 0; j < num_nodes; j++) {
-      stk::mesh::Entity rowNode = node_rels[j];
+      const GO rowNodeGID = gid(node_rels[j]);
 
       // loop over eqs
       for (std::size_t k = 0; k < globalEqns.size(); ++k) {
-        row = getGlobalDOF(gid(rowNode), globalEqns[k]);
-        for (std::size_t l = 0; l < num_nodes; l++) {
-          stk::mesh::Entity colNode = node_rels[l];
-          for (std::size_t m = 0; m < neq; m++)  // Note: here we cycle through
-                                                 // ALL the eqns (not just the
-                                                 // global ones),
-          {  //       since they could all be coupled with this eq
-            col   = getGlobalDOF(gid(colNode), m);
-            colAV = Teuchos::arrayView(&col, 1);
-            overlap_graphT->insertGlobalIndices(row, colAV);
-          }
-        }
+        row = getGlobalDOF(rowNodeGID, globalEqns[k]);
+        overlap_graphT->insertGlobalIndices(row, colAV);
       }
     }
   }
@@ -1783,23 +1890,20 @@ Albany::STKDiscretization::computeGraphsUpToFillComplete()
           stk::mesh::Entity const* node_rels = bulkData.begin_nodes(sidee);
           const size_t             num_nodes = bulkData.num_nodes(sidee);
 
+          // loop over local nodes of the side (col) and on all the
+          // equations (the eq may be coupled with other eqns)
+          cols.resize(num_nodes * neq);
+          for (std::size_t j = 0; j < num_nodes; j++) {
+            const GO colNodeGID = gid(node_rels[j]);
+            for (std::size_t m = 0; m < neq; m++)
+              cols[j * neq + m] = getGlobalDOF(colNodeGID, m);
+          }
+          colAV = Teuchos::arrayView(cols.data(), cols.size());
+
           // loop over local nodes of the side (row)
           for (std::size_t i = 0; i < num_nodes; i++) {
-            stk::mesh::Entity rowNode = node_rels[i];
-            row                       = getGlobalDOF(gid(rowNode), eq);
-
-            // loop over local nodes of the side (col)
-            for (std::size_t j = 0; j < num_nodes; j++) {
-              stk::mesh::Entity colNode = node_rels[j];
-
-              // loop on all the equations (the eq may be coupled with other
-              // eqns)
-              for (std::size_t m = 0; m < neq; m++) {
-                col   = getGlobalDOF(gid(colNode), m);
-                colAV = Teuchos::arrayView(&col, 1);
-                overlap_graphT->insertGlobalIndices(row, colAV);
-              }
-            }
+            row = getGlobalDOF(gid(node_rels[i]), eq);
+            overlap_graphT->insertGlobalIndices(row, colAV);
           }
         }
       }
@@ -2636,6 +2740,38 @@ Albany::STKDiscretization::setupExodusOutput()
 
     std::string str = stkMeshStruct->exoOutFile;
 
+    flushExodusOutput();
+
+    // Asynchronous output writes every field from its staging copy; fields
+    // declared after the copies were set up are not staged.
+    std::map<const stk::mesh::FieldBase*, stk::mesh::FieldBase*> staging;
+    std::set<const stk::mesh::FieldBase*> stagingFields;
+    for (auto const& it : stkMeshStruct->exoOutputStagingFields) {
+      staging[it.first] = it.second;
+      stagingFields.insert(it.second);
+    }
+    const stk::mesh::FieldVector& allFields = metaData.get_fields();
+    for (size_t i = 0; stkMeshStruct->exoOutputAsync && i < allFields.size(); i++) {
+      if (allFields[i] != metaData.coordinate_field() &&
+          staging.count(allFields[i]) == 0 &&
+          stagingFields.count(allFields[i]) == 0) {
+        if (commT->getRank() == 0)
+          *out << "\nWARNING: Asynchronous Exodus Output has no staging copy "
+               << "of field " << allFields[i]->name()
+               << ": writing exodus output synchronously \n"
+               << std::endl;
+        stkMeshStruct->exoOutputAsync = false;
+      }
+    }
+    if (!stkMeshStruct->exoOutputAsync) {
+      staging.clear();
+      output_queue_ = Teuchos::null;
+    } else if (output_queue_.is_null()) {
+      output_queue_ = Teuchos::rcp(new AsyncOutputQueue(1));
+    }
+
+    std::lock_guard<std::mutex> lock(fileIoMutex());
+
     Ioss::Init::Initializer io;
 
     mesh_data = Teuchos::rcp(
@@ -2658,13 +2794,19 @@ Albany::STKDiscretization::setupExodusOutput()
 
     const stk::mesh::FieldVector& fields = mesh_data->meta_data().get_fields();
     for (size_t i = 0; i < fields.size(); i++) {
+      if (stagingFields.count(fields[i]) > 0) continue;
       // Hacky, but doesn't appear to be a way to query if a field is already
       // going to be output.
       try {
-        mesh_data->add_field(outputFileIdx, *fields[i]);
+        if (staging.count(fields[i]) > 0)
+          mesh_data->add_field(
+              outputFileIdx, *staging[fields[i]], fields[i]->name());
+        else
+          mesh_data->add_field(outputFileIdx, *fields[i]);
       } catch (std::runtime_error const&) {
       }
     }
+    exoOutputSteps = 0;
   }
 #else
   if (stkMeshStruct->exoOutput)
@@ -2675,6 +2817,80 @@ Albany::STKDiscretization::setupExodusOutput()
 #endif
 }
 
+int
+Albany::STKDiscretization::writeExodusOutputStep(const double time_label)
+{
+#ifdef ALBANY_SEACAS
+  Teuchos::RCP<AbstractSTKFieldContainer> container =
+      stkMeshStruct->getFieldContainer();
+
+  // The previous step still reads mesh_data and the staging fields
+  flushExodusOutput();
+
+  if (output_queue_.is_null()) {
+    std::lock_guard<std::mutex> lock(fileIoMutex());
+    mesh_data->begin_output_step(outputFileIdx, time_label);
+    int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
+    // Writing mesh global variables
+    for (auto& it : container->getMeshVectorStates()) {
+      mesh_data->write_global(outputFileIdx, it.first, it.second);
+    }
+    for (auto& it : container->getMeshScalarIntegerStates()) {
+      mesh_data->write_global(outputFileIdx, it.first, it.second);
+    }
+    mesh_data->end_output_step(outputFileIdx);
+    return out_step;
+  }
+
+  // Take the step's data on this thread, so that the solver may change the
+  // fields and the mesh global variables while the writer thread writes it
+  for (auto const& it : stkMeshStruct->exoOutputStagingFields) {
+    const stk::mesh::BucketVector& buckets =
+        bulkData.buckets(it.first->entity_rank());
+    for (size_t b = 0; b < buckets.size(); b++) {
+      const stk::mesh::Bucket& bucket = *buckets[b];
+      const unsigned bytes = stk::mesh::field_bytes_per_entity(*it.first, bucket);
+      if (bytes == 0) continue;
+      std::memcpy(
+          stk::mesh::field_data(*it.second, bucket),
+          stk::mesh::field_data(*it.first, bucket),
+          bytes * bucket.size());
+    }
+  }
+  AbstractSTKFieldContainer::MeshVectorState vectorStates =
+      container->getMeshVectorStates();
+  AbstractSTKFieldContainer::MeshScalarIntegerState integerStates =
+      container->getMeshScalarIntegerStates();
+
+  Teuchos::RCP<stk::io::StkMeshIoBroker> broker  = mesh_data;
+  const size_t                           fileIdx = outputFileIdx;
+  output_queue_->push(
+      [broker, fileIdx, time_label, vectorStates, integerStates]() mutable {
+        std::lock_guard<std::mutex> lock(fileIoMutex());
+        broker->begin_output_step(fileIdx, time_label);
+        broker->write_defined_output_fields(fileIdx);
+        for (auto& it : vectorStates) {
+          broker->write_global(fileIdx, it.first, it.second);
+        }
+        for (auto& it : integerStates) {
+          broker->write_global(fileIdx, it.first, it.second);
+        }
+        broker->end_output_step(fileIdx);
+      });
+  return ++exoOutputSteps;
+#else
+  return 0;
+#endif
+}
+
+void
+Albany::STKDiscretization::flushExodusOutput()
+{
+#ifdef ALBANY_SEACAS
+  if (!output_queue_.is_null()) output_queue_->flush();
+#endif
+}
+
 namespace {
 const std::vector<double>
 spherical_to_cart(const std::pair<double, double>& sphere)
@@ -3275,7 +3491,11 @@ Albany::STKDiscretization::reNameExodusOutput(std::string& filename)
 #ifdef ALBANY_SEACAS
   if (stkMeshStruct->exoOutput && !mesh_data.is_null()) {
     // Delete the mesh data object and recreate it
-    mesh_data = Teuchos::null;
+    flushExodusOutput();
+    {
+      std::lock_guard<std::mutex> lock(fileIoMutex());
+      mesh_data = Teuchos::null;
+    }
 
     stkMeshStruct->exoOutFile = filename;
 
@@ -3558,6 +3778,12 @@ Albany::STKDiscretization::buildSideSetProjectors()
 void
 Albany::STKDiscretization::updateMesh()
 {
+  // Anything cached from the previous mesh is now stale.
+  ++mesh_version_;
+
+  // The writer thread must not read the mesh while it is rebuilt
+  flushExodusOutput();
+
   const Albany::StateInfoStruct& nodal_param_states =
       stkMeshStruct->getFieldContainer()->getNodalParameterSIS();
   nodalDOFsStructContainer.addEmptyDOFsStruct("ordinary_solution", "", neq);
@@ -3575,6 +3801,8 @@ Albany::STKDiscretization::updateMesh()
         param_state.name, param_state.meshPart, numComps);
   }
 
+  computeNodeOrdering();
+
   computeNodalMaps(false);
 
   computeOwnedNodesAndUnknowns();
@@ -7,6 +7,7 @@
 #ifndef ALBANY_STKDISCRETIZATION_HPP
 #define ALBANY_STKDISCRETIZATION_HPP
 
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -31,6 +32,8 @@
 #include <stk_util/parallel/Parallel.hpp>
 #ifdef ALBANY_SEACAS
 #include <stk_io/StkMeshIoBroker.hpp>
+
+#include "Albany_AsyncOutputQueue.hpp"
 #endif
 
 namespace Albany {
@@ -276,6 +279,22 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   getCoordinates() const;
   void
   setCoordinates(const Teuchos::ArrayRCP<const double>& c);
+
+  //! Incremented by updateMesh() and whenever the solution is transferred
+  //! to the coordinates
+  int
+  getMeshVersion() const
+  {
+    return mesh_version_;
+  }
+
+  //! Incremented every time the graphs are computed
+  int
+  getGraphVersion() const
+  {
+    return graph_version_;
+  }
+
   void
   setReferenceConfigurationManager(
       const Teuchos::RCP<AAdapt::rc::Manager>& rcm);
@@ -614,6 +633,13 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   double
   monotonicTimeLabel(const double time);
 
+  //! Compute the node ordering selected by "Node Ordering"
+  void
+  computeNodeOrdering();
+  //! Sort nodes by the node ordering, if any
+  void
+  sortByNodeOrder(std::vector<stk::mesh::Entity>& nodes) const;
+
   void
   computeNodalMaps(bool overlapped);
 
@@ -641,6 +667,13 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   //! Call stk_io for creating exodus output file
   void
   setupExodusOutput();
+  //! Write an exodus output step, on the writer thread if asynchronous
+  //! output is enabled; returns the index of the step
+  int
+  writeExodusOutputStep(const double time_label);
+  //! Wait until the writer thread is done with mesh_data
+  void
+  flushExodusOutput();
   //! Call stk_io for creating NetCDF output file
   void
   setupNetCDFOutput();
@@ -809,9 +842,26 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   int outputInterval;
 
   size_t outputFileIdx;
+
+  //! Number of steps queued for asynchronous output in the current file
+  int exoOutputSteps;
+
+  //! Writer thread for asynchronous exodus output. Declared after
+  //! mesh_data so that it is destroyed, and thus flushed, first.
+  Teuchos::RCP<AsyncOutputQueue> output_queue_;
 #endif
   bool interleavedOrdering;
 
+  //! Mesh version, see getMeshVersion()
+  int mesh_version_{0};
+
+  //! Graph version, see getGraphVersion()
+  int graph_version_{0};
+
+  //! Position of each overlap node (by GID) in the local numbering, empty
+  //! for the STK bucket order
+  std::unordered_map<GO, int> node_order_;
+
  private:
   Teuchos::RCP<Tpetra_CrsGraph> nodalGraph;
 
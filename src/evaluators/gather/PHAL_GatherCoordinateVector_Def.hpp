@@ -9,6 +9,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 
 namespace PHAL {
 
@@ -65,6 +66,7 @@ void GatherCoordinateVector<EvalT, Traits>::postRegistrationSetup(typename Trait
 template<typename EvalT, typename Traits>
 void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 { 
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
   unsigned int numCells = workset.numCells;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords = workset.wsCoords;
 
@@ -6,6 +6,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
 #include "PHAL_Workset.hpp"
@@ -49,6 +50,7 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFInterpolationBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
   //Intrepid2 version:
   // for (int i=0; i < val_qp.size() ; i++) val_qp[i] = 0.0;
   // Intrepid2::FunctionSpaceTools:: evaluate<ScalarT>(val_qp, val_node, BF);
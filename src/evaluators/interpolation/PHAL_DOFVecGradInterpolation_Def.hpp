@@ -9,6 +9,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
@@ -83,6 +84,7 @@ namespace PHAL {
   void DOFVecGradInterpolationBase<EvalT, Traits, ScalarT>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
         for (std::size_t qp=0; qp < numQPs; ++qp) {
@@ -149,6 +151,7 @@ namespace PHAL {
   void FastSolutionVecGradInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL::EvaluatorProfile<PHAL::AlbanyTraits::Jacobian> profile(*this, workset);
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
     const int num_dof = this->val_node(0,0,0).size();
     const int neq = workset.wsElNodeEqID.dimension(2);
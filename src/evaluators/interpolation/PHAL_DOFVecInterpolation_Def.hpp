@@ -8,6 +8,7 @@
 #endif
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
@@ -92,6 +93,7 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFVecInterpolationBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < numQPs; ++qp) {
@@ -188,6 +190,7 @@ template<typename Traits>
 void FastSolutionVecInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<PHAL::AlbanyTraits::Jacobian> profile(*this, workset);
   int num_dof = this->val_node(0,0,0).size();
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   const int neq = workset.wsElNodeEqID.dimension(2);
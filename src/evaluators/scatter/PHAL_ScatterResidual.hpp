@@ -15,6 +15,8 @@
 #include "Albany_Layouts.hpp"
 
 #include "Teuchos_ParameterList.hpp"
+
+#include <vector>
 #ifdef ALBANY_EPETRA
 #include "Epetra_Vector.h"
 #endif
@@ -164,6 +166,23 @@ protected:
 private:
   typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
 
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  //! Positions in the local values array of the Jacobian of all the
+  //! (cell, node, eq, local unknown) entries of one workset, valid for
+  //! one mesh version and graph version of the discretization
+  struct JacobianOffsets {
+    int mesh_version;
+    int graph_version;
+    std::vector<LO> offsets;
+  };
+  //! Indexed by workset index
+  std::vector<JacobianOffsets> jac_offsets;
+
+  //! Return the offsets of this workset, computing them if needed, or
+  //! nullptr if they may not be cached
+  const std::vector<LO>* getJacobianOffsets(typename Traits::EvalData workset);
+#endif
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 public:
   struct PHAL_ScatterResRank0_Tag{};
@@ -8,6 +8,8 @@
 #endif
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
+#include "Albany_FrozenElements.hpp"
 #include "Albany_Utils.hpp"
 
 // **********************************************************************
@@ -155,6 +157,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<PHAL::AlbanyTraits::Residual> profile(*this, workset);
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Tpetra_Vector> fT = workset.fT;
@@ -487,6 +490,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<PHAL::AlbanyTraits::Jacobian> profile(*this, workset);
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Tpetra_Vector> fT = workset.fT;
@@ -499,6 +503,43 @@ evaluateFields(typename Traits::EvalData workset)
   int numDims = 0;
   if (this->tensorRank==2) numDims = this->valTensor.dimension(2);
 
+  // Element matrices for the "Frozen Element Jacobians" mode
+  Albany::FrozenElements* const frozen =
+    workset.is_adjoint ? nullptr : workset.frozen_elements.get();
+
+  const std::vector<LO>* offsets =
+    workset.is_adjoint ? nullptr : getJacobianOffsets(workset);
+  if (offsets != nullptr) {
+    // Add the derivatives straight into the values of the local matrix,
+    // without searching the matrix rows for the columns. Worksets that
+    // are filled concurrently share no rows (see the workset coloring in
+    // Albany::Application), so this needs no atomics.
+    auto values = JacT->getLocalMatrix().values;
+    const LO* off = offsets->data();
+    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      for (std::size_t node = 0; node < this->numNodes; ++node) {
+        for (std::size_t eq = 0; eq < numFields; eq++, off += nunk) {
+          typename PHAL::Ref<ScalarT const>::type
+            valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
+                      this->tensorRank == 1 ? this->valVec(cell,node,eq) :
+                      this->valTensor(cell,node, eq/numDims, eq%numDims));
+          if (loadResid)
+            fT->sumIntoLocalValue(nodeID(cell,node,this->offset + eq), valptr.val());
+          if (valptr.hasFastAccess()) {
+            for (int lunk = 0; lunk < nunk; lunk++)
+              values(off[lunk]) += valptr.fastAccessDx(lunk);
+            ST* const elem_row = frozen == nullptr ? nullptr :
+              frozen->recordingRow(workset.wsIndex, cell, neq*node + this->offset + eq);
+            if (elem_row != nullptr)
+              for (int lunk = 0; lunk < nunk; lunk++)
+                elem_row[lunk] += valptr.fastAccessDx(lunk);
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0, i=0; node_col<this->numNodes; node_col++){
@@ -528,6 +569,11 @@ evaluateFields(typename Traits::EvalData workset)
             // Sum Jacobian entries all at once
             JacT->sumIntoLocalValues(
               rowT, colT, Teuchos::arrayView(&(valptr.fastAccessDx(0)), nunk));
+            ST* const elem_row = frozen == nullptr ? nullptr :
+              frozen->recordingRow(workset.wsIndex, cell, neq*node + this->offset + eq);
+            if (elem_row != nullptr)
+              for (unsigned int lunk = 0; lunk < nunk; lunk++)
+                elem_row[lunk] += valptr.fastAccessDx(lunk);
           }
         } // has fast access
       }
@@ -614,6 +660,68 @@ evaluateFields(typename Traits::EvalData workset)
 #endif
 }
 
+// **********************************************************************
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+template<typename Traits>
+const std::vector<LO>* ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
+getJacobianOffsets(typename Traits::EvalData workset)
+{
+  if (!workset.cache_jacobian_offsets || workset.disc.is_null())
+    return nullptr;
+
+  const int mesh_version = workset.disc->getMeshVersion();
+  const int graph_version = workset.disc->getGraphVersion();
+  if (mesh_version < 0 || graph_version < 0)
+    return nullptr;
+
+  // The versions only describe the discretization's overlap Jacobian graph,
+  // so the offsets are only cached for matrices built on that graph.
+  Teuchos::RCP<Tpetra_CrsMatrix> JacT = workset.JacT;
+  if (JacT->getCrsGraph().get() !=
+      workset.disc->getOverlapJacobianGraphT().get())
+    return nullptr;
+
+  if (jac_offsets.size() <= workset.wsIndex)
+    jac_offsets.resize(workset.wsIndex + 1, JacobianOffsets{-1, -1});
+
+  JacobianOffsets& cache = jac_offsets[workset.wsIndex];
+  if (cache.mesh_version == mesh_version &&
+      cache.graph_version == graph_version)
+    return &cache.offsets;
+
+  auto nodeID = workset.wsElNodeEqID;
+  const int neq = nodeID.dimension(2);
+  const int nunk = neq*this->numNodes;
+  const auto lclGraph = JacT->getLocalMatrix().graph;
+
+  cache.offsets.resize(workset.numCells*this->numNodes*numFields*nunk);
+  LO* off = cache.offsets.data();
+  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    for (std::size_t node = 0; node < this->numNodes; ++node) {
+      for (std::size_t eq = 0; eq < numFields; eq++) {
+        const LO rowT = nodeID(cell,node,this->offset + eq);
+        const LO rowBegin = lclGraph.row_map(rowT);
+        const LO rowEnd = lclGraph.row_map(rowT+1);
+        for (unsigned int node_col=0; node_col<this->numNodes; node_col++) {
+          for (unsigned int eq_col=0; eq_col<neq; eq_col++, off++) {
+            const LO colT = nodeID(cell,node_col,eq_col);
+            LO k = rowBegin;
+            while (k < rowEnd && lclGraph.entries(k) != colT) ++k;
+            TEUCHOS_TEST_FOR_EXCEPTION(k == rowEnd, std::logic_error,
+              "Error in PHAL::ScatterResidual<Jacobian>: column " << colT
+              << " is not in row " << rowT << " of the Jacobian graph.\n");
+            *off = k;
+          }
+        }
+      }
+    }
+  }
+  cache.mesh_version = mesh_version;
+  cache.graph_version = graph_version;
+  return &cache.offsets;
+}
+#endif
+
 // **********************************************************************
 // Specialization: Tangent
 // **********************************************************************
@@ -632,6 +740,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<PHAL::AlbanyTraits::Tangent> profile(*this, workset);
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Tpetra_Vector> fT = workset.fT;
   Teuchos::RCP<Tpetra_MultiVector> JVT = workset.JVT;
@@ -683,6 +792,7 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<PHAL::AlbanyTraits::DistParamDeriv> profile(*this, workset);
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Tpetra_MultiVector> fpVT = workset.fpVT;
   bool trans = workset.transpose_dist_param_deriv;
@@ -17,6 +17,8 @@
 #include "Intrepid2_CellTools.hpp"
 #include "Intrepid2_Cubature.hpp"
 
+#include <vector>
+
 namespace PHAL {
 
 /** \brief Finite Element Interpolation Evaluator
@@ -43,6 +45,25 @@ private:
   typedef typename EvalT::MeshScalarT MeshScalarT;
   int  numVertices, numDims, numNodes, numQPs, numCells;
 
+  //! Copies of the output fields of one workset, valid while the mesh
+  //! version of the discretization is unchanged.
+  struct BasisCache {
+    int mesh_version;
+    unsigned int num_cells;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_measure;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobian_det;
+    Kokkos::DynRankView<RealType, PHX::Device> BF;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> wBF;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> GradBF;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> wGradBF;
+  };
+  //! Indexed by workset index
+  std::vector<BasisCache> basis_cache;
+
+  //! Return the cache entry of this workset if the basis data may be
+  //! cached, or nullptr otherwise
+  BasisCache* getBasisCache(typename Traits::EvalData workset);
+
   // Input:
   //! Coordinate vector at vertices
   PHX::MDField<const MeshScalarT,Cell,Vertex,Dim> coordVec;
@@ -6,9 +6,12 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorProfile.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
+#include <type_traits>
+
 namespace PHAL {
 
 template<typename EvalT, typename Traits>
@@ -86,6 +89,7 @@ template<typename EvalT, typename Traits>
 void ComputeBasisFunctions<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL::EvaluatorProfile<EvalT> profile(*this, workset);
 
   /** The allocated size of the Field Containers must currently
     * match the full workset size of the allocated PHX Fields,
@@ -98,6 +102,17 @@ evaluateFields(typename Traits::EvalData workset)
   typedef typename Intrepid2::CellTools<PHX::Device>   ICT;
   typedef Intrepid2::FunctionSpaceTools<PHX::Device>   IFST;
 
+  BasisCache* cache = getBasisCache(workset);
+  if (cache != nullptr && cache->mesh_version >= 0) {
+    Kokkos::deep_copy(weighted_measure.get_view(), cache->weighted_measure);
+    Kokkos::deep_copy(jacobian_det.get_view(), cache->jacobian_det);
+    Kokkos::deep_copy(BF.get_view(), cache->BF);
+    Kokkos::deep_copy(wBF.get_view(), cache->wBF);
+    Kokkos::deep_copy(GradBF.get_view(), cache->GradBF);
+    Kokkos::deep_copy(wGradBF.get_view(), cache->wGradBF);
+    return;
+  }
+
   ICT::setJacobian(jacobian, refPoints, coordVec.get_view(), intrepidBasis);
   ICT::setJacobianInv (jacobian_inv, jacobian);
   ICT::setJacobianDet (jacobian_det.get_view(), jacobian);
@@ -110,6 +125,53 @@ evaluateFields(typename Traits::EvalData workset)
   IFST::multiplyMeasure    (wGradBF.get_view(), weighted_measure.get_view(), GradBF.get_view());
 
   (void)isJacobianDetNegative;
+
+  if (cache != nullptr) {
+    Kokkos::deep_copy(cache->weighted_measure, weighted_measure.get_view());
+    Kokkos::deep_copy(cache->jacobian_det, jacobian_det.get_view());
+    Kokkos::deep_copy(cache->BF, BF.get_view());
+    Kokkos::deep_copy(cache->wBF, wBF.get_view());
+    Kokkos::deep_copy(cache->GradBF, GradBF.get_view());
+    Kokkos::deep_copy(cache->wGradBF, wGradBF.get_view());
+    cache->mesh_version = workset.disc->getMeshVersion();
+    cache->num_cells = workset.numCells;
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+typename ComputeBasisFunctions<EvalT, Traits>::BasisCache*
+ComputeBasisFunctions<EvalT, Traits>::
+getBasisCache(typename Traits::EvalData workset)
+{
+  // If the mesh scalar type carries derivatives, the coordinates depend on
+  // parameters and the basis data changes from one evaluation to the next.
+  if (!std::is_same<MeshScalarT, RealType>::value ||
+      !workset.cache_basis_functions || workset.disc.is_null())
+    return nullptr;
+
+  const int mesh_version = workset.disc->getMeshVersion();
+  if (mesh_version < 0)
+    return nullptr;
+
+  if (basis_cache.size() <= workset.wsIndex)
+    basis_cache.resize(workset.wsIndex + 1, BasisCache{-1, 0});
+
+  BasisCache& cache = basis_cache[workset.wsIndex];
+  if (cache.BF.size() == 0) {
+    cache.weighted_measure = Kokkos::createDynRankView(weighted_measure.get_view(), "BasisCache", numCells, numQPs);
+    cache.jacobian_det = Kokkos::createDynRankView(jacobian_det.get_view(), "BasisCache", numCells, numQPs);
+    cache.BF = Kokkos::createDynRankView(BF.get_view(), "BasisCache", numCells, numNodes, numQPs);
+    cache.wBF = Kokkos::createDynRankView(wBF.get_view(), "BasisCache", numCells, numNodes, numQPs);
+    cache.GradBF = Kokkos::createDynRankView(GradBF.get_view(), "BasisCache", numCells, numNodes, numQPs, numDims);
+    cache.wGradBF = Kokkos::createDynRankView(wGradBF.get_view(), "BasisCache", numCells, numNodes, numQPs, numDims);
+  }
+
+  // Invalidate the entry if the mesh changed since it was filled.
+  if (cache.mesh_version != mesh_version || cache.num_cells != workset.numCells)
+    cache.mesh_version = -1;
+
+  return &cache;
 }
 
 //**********************************************************************
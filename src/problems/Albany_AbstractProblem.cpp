@@ -157,6 +157,32 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
+  validPL->set<bool>("Cache Basis Functions", false,
+                     "Compute basis functions once per workset and reuse them until the mesh changes (static meshes only)");
+  validPL->set<bool>("Cache Jacobian Offsets", false,
+                     "Precompute where each element contribution goes in the local Jacobian, trading memory for a faster scatter");
+  validPL->set<bool>("Linear Jacobian Reuse", false,
+                     "The problem is linear: assemble K = df/dx, M = df/dxdot and N = df/dxdotdot once until the mesh or parameters change, form the Jacobian as beta*K + alpha*M + omega*N and evaluate the residual as K*x + M*xdot + N*xdotdot + c. The offset c, which holds the Dirichlet values and sources, is recomputed with one residual fill at each new time; otherwise the evaluators are skipped. Not allowed for problems that save states at the quadrature points, and state outputs are only updated by those fills");
+  validPL->set<bool>("Linear Problem Time Dependent", false,
+                     "With Linear Jacobian Reuse: K, M or N depend on time, e.g. through time-dependent material coefficients, so they are reassembled at every new time. Time-dependent Dirichlet values and sources do not need it");
+  validPL->set<bool>("Reuse Symbolic Setup", false,
+                     "Let Ifpack2 and MueLu preconditioners keep their symbolic setup while the Jacobian graph does not change, redoing only the numeric phase. For MueLu also set \"reuse: type\"");
+  validPL->set<bool>("Frozen Element Jacobians", false,
+                     "Reuse the element matrices of worksets whose cells were all flagged unchanged by an evaluator and whose solution and its time derivatives moved less than Frozen Element Tolerance since their last Jacobian evaluation at the same time");
+  validPL->set<double>("Frozen Element Tolerance", 1.0e-6,
+                       "Largest change of a solution or time derivative value of a cell for which its element matrix is reused");
+  validPL->set<bool>("Frozen Element Requires Flag", true,
+                     "Only reuse the element matrices of cells flagged unchanged by an evaluator, e.g. J2 cells without plastic flow");
+  validPL->set<bool>("Matrix-Free Jacobian", false,
+                     "Apply the Jacobian with a Tangent fill per Krylov iteration instead of assembling it. Use with a physics-based preconditioner such as \"Block Jacobi\"");
+  validPL->set<int>("Preconditioner Update Interval", 1,
+                    "Rebuild the physics-based preconditioner only every this many Jacobian evaluations");
+  validPL->set<bool>("Profile Evaluators", false,
+                     "Record time, cells and MDField traffic of the instrumented evaluators and the time of every workset, reported at exit");
+  validPL->set<std::string>("Evaluator Profile File", "evaluator_profile.json",
+                            "JSON file written at exit when Profile Evaluators is set");
+  validPL->set<int>("Fill Threads", 1,
+                    "Number of threads for the residual and Jacobian fill (requires thread-safe Teuchos RCPs and the Kokkos OpenMP execution space)");
 
   validPL->sublist("Model Order Reduction", false, "Specify the options relative to model order reduction");
 
@@ -0,0 +1,212 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#include "EvaluatorMonitor.hpp"
+#include "DisplayTable.hpp"
+
+#include <Teuchos_DefaultComm.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace util {
+
+namespace {
+
+template <typename Key>
+std::vector<std::pair<Key, EvaluatorMonitor::Stats> > sortedByTime (
+    const std::map<Key, EvaluatorMonitor::Stats>& stats) {
+  typedef std::pair<Key, EvaluatorMonitor::Stats> entry;
+  std::vector<entry> entries(stats.begin(), stats.end());
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const entry& a, const entry& b) {
+                     return a.second.seconds > b.second.seconds;
+                   });
+  return entries;
+}
+
+// Per evaluation type, the workset time not covered by the evaluator guards
+std::map<EvaluatorMonitor::key_type, EvaluatorMonitor::Stats> withOthers (
+    const std::map<EvaluatorMonitor::key_type, EvaluatorMonitor::Stats>& stats,
+    const std::map<EvaluatorMonitor::workset_key_type,
+                   EvaluatorMonitor::Stats>& workset_stats) {
+  std::map<string, EvaluatorMonitor::Stats> types;
+  for (auto& w : workset_stats) {
+    EvaluatorMonitor::Stats& t = types[w.first.first];
+    t.seconds += w.second.seconds;
+    t.calls   += w.second.calls;
+    t.cells   += w.second.cells;
+    t.deriv_length = std::max(t.deriv_length, w.second.deriv_length);
+  }
+  for (auto& s : stats) {
+    auto t = types.find(s.first.first);
+    if (t != types.end())
+      t->second.seconds -= s.second.seconds;
+  }
+
+  std::map<EvaluatorMonitor::key_type, EvaluatorMonitor::Stats> all(stats);
+  for (auto& t : types)
+    if (t.second.seconds > 0.0)
+      all[EvaluatorMonitor::key_type(t.first, "(other evaluators)")] =
+          t.second;
+  return all;
+}
+
+string fixed (double val, int precision) {
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(precision) << val;
+  return ss.str();
+}
+
+string jsonEscape (const string& s) {
+  string escaped;
+  for (char c : s) {
+    if (c == '"' || c == '\\')
+      escaped += '\\';
+    escaped += c;
+  }
+  return escaped;
+}
+
+}
+
+void EvaluatorMonitor::record (const string& eval_type,
+                               const string& evaluator, double seconds,
+                               std::size_t cells, std::size_t bytes,
+                               std::size_t deriv_length) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats& s = stats_[key_type(eval_type, evaluator)];
+  s.seconds += seconds;
+  s.calls   += 1;
+  s.cells   += cells;
+  s.bytes   += bytes;
+  s.deriv_length = std::max(s.deriv_length, deriv_length);
+}
+
+void EvaluatorMonitor::recordWorkset (const string& eval_type,
+                                      int workset, double seconds,
+                                      std::size_t cells,
+                                      std::size_t deriv_length) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats& s = workset_stats_[workset_key_type(eval_type, workset)];
+  s.seconds += seconds;
+  s.calls   += 1;
+  s.cells   += cells;
+  s.deriv_length = std::max(s.deriv_length, deriv_length);
+}
+
+void EvaluatorMonitor::reset () {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.clear();
+  workset_stats_.clear();
+}
+
+void EvaluatorMonitor::summarize (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) {
+  if (comm->getRank() != 0 || empty())
+    return;
+
+  const std::map<key_type, Stats> all = withOthers(stats_, workset_stats_);
+  double total = 0.0;
+  for (auto& s : all)
+    total += s.second.seconds;
+
+  DisplayTable table;
+  table.addRow("Type", "Evaluator", "Time (s)", "%", "Calls", "Cells",
+               "ns/cell", "MB", "GB/s", "Derivs");
+  for (auto& e : sortedByTime(all)) {
+    const Stats& s = e.second;
+    const double cells = std::max<std::size_t>(s.cells, 1);
+    const double gbs = s.seconds > 0.0 ? 1.0e-9 * s.bytes / s.seconds : 0.0;
+    table.addRow(e.first.first, e.first.second, fixed(s.seconds, 4),
+                 fixed(total > 0.0 ? 100.0 * s.seconds / total : 0.0, 1),
+                 s.calls, s.cells, fixed(1.0e9 * s.seconds / cells, 1),
+                 fixed(1.0e-6 * s.bytes, 1), fixed(gbs, 2), s.deriv_length);
+  }
+
+  out << "Evaluator profile (rank 0, MDField traffic from field layouts)\n";
+  table.write(out);
+
+  if (workset_stats_.empty())
+    return;
+
+  DisplayTable worksets;
+  worksets.addRow("Type", "Workset", "Time (s)", "Calls", "Cells", "ns/cell",
+                  "Derivs");
+  for (auto& e : sortedByTime(workset_stats_)) {
+    const Stats& s = e.second;
+    const double cells = std::max<std::size_t>(s.cells, 1);
+    worksets.addRow(e.first.first, e.first.second, fixed(s.seconds, 4),
+                    s.calls, s.cells, fixed(1.0e9 * s.seconds / cells, 1),
+                    s.deriv_length);
+  }
+
+  out << "Workset profile (rank 0, all evaluators of the workset)\n";
+  worksets.write(out);
+}
+
+void EvaluatorMonitor::summarize (std::ostream& out) {
+  // MPI should be initialized before this call
+  Teuchos::RCP<const Teuchos::Comm<int> > comm =
+      Teuchos::DefaultComm<int>::getComm();
+
+  summarize(comm.ptr(), out);
+}
+
+void EvaluatorMonitor::writeJSON (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) {
+  if (comm->getRank() != 0)
+    return;
+
+  out << "{\n\"evaluators\": [\n";
+  bool first = true;
+  for (auto& e : sortedByTime(withOthers(stats_, workset_stats_))) {
+    const Stats& s = e.second;
+    if (!first)
+      out << ",\n";
+    first = false;
+    out << "  {\"type\": \"" << jsonEscape(e.first.first)
+        << "\", \"evaluator\": \"" << jsonEscape(e.first.second)
+        << "\", \"seconds\": " << std::setprecision(9) << s.seconds
+        << ", \"calls\": " << s.calls << ", \"cells\": " << s.cells
+        << ", \"bytes\": " << s.bytes
+        << ", \"deriv_length\": " << s.deriv_length << "}";
+  }
+  out << "\n],\n\"worksets\": [\n";
+  first = true;
+  for (auto& e : sortedByTime(workset_stats_)) {
+    const Stats& s = e.second;
+    if (!first)
+      out << ",\n";
+    first = false;
+    out << "  {\"type\": \"" << jsonEscape(e.first.first)
+        << "\", \"workset\": " << e.first.second
+        << ", \"seconds\": " << std::setprecision(9) << s.seconds
+        << ", \"calls\": " << s.calls << ", \"cells\": " << s.cells
+        << ", \"deriv_length\": " << s.deriv_length << "}";
+  }
+  out << "\n]\n}\n";
+}
+
+void EvaluatorMonitor::writeJSON () {
+  if (json_file_.empty() || empty())
+    return;
+
+  Teuchos::RCP<const Teuchos::Comm<int> > comm =
+      Teuchos::DefaultComm<int>::getComm();
+  if (comm->getRank() != 0)
+    return;
+
+  std::ofstream json(json_file_.c_str());
+  writeJSON(comm.ptr(), json);
+}
+
+}
@@ -0,0 +1,95 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#ifndef UTIL_EVALUATORMONITOR_HPP
+#define UTIL_EVALUATORMONITOR_HPP
+
+/**
+ *  \file EvaluatorMonitor.hpp
+ *
+ *  \brief Per-evaluator fill statistics: time, cells, MDField traffic and
+ *  derivative length, reported as a table and as JSON.
+ */
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_PtrDecl.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "string.hpp"
+
+namespace util {
+
+class EvaluatorMonitor {
+public:
+
+  struct Stats {
+    double      seconds{0.0};
+    std::size_t calls{0};
+    std::size_t cells{0};
+    std::size_t bytes{0};
+    std::size_t deriv_length{0};
+  };
+
+  //! (evaluation type, evaluator name)
+  typedef std::pair<string, string> key_type;
+
+  //! (evaluation type, workset index)
+  typedef std::pair<string, int> workset_key_type;
+
+  EvaluatorMonitor () = default;
+
+  //! Add one evaluation of one evaluator on one workset. Thread safe.
+  void record (const string& eval_type, const string& evaluator,
+               double seconds, std::size_t cells, std::size_t bytes,
+               std::size_t deriv_length);
+
+  //! Add one evaluation of all the evaluators of one workset. Thread safe.
+  void recordWorkset (const string& eval_type, int workset, double seconds,
+                      std::size_t cells, std::size_t deriv_length);
+
+  bool empty () const {
+    return stats_.empty() && workset_stats_.empty();
+  }
+
+  void reset ();
+
+  //! File written by writeJSON(); empty means no file
+  void setJSONFile (const string& name) {
+    json_file_ = name;
+  }
+
+  //! Table of all evaluators, slowest first, and of all worksets, on rank
+  //! 0. Time spent in evaluators without a guard is listed as
+  //! "(other evaluators)".
+  void summarize (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out = std::cout);
+  void summarize (std::ostream &out = std::cout);
+
+  //! Same data as summarize() as a JSON object with an "evaluators" and a
+  //! "worksets" array, on rank 0
+  void writeJSON (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out);
+  //! Write the JSON to the file given to setJSONFile(), if any
+  void writeJSON ();
+
+private:
+
+  std::map<key_type, Stats> stats_;
+  std::map<workset_key_type, Stats> workset_stats_;
+  string json_file_;
+  std::mutex mutex_;
+};
+
+}
+
+#endif  // UTIL_EVALUATORMONITOR_HPP
@@ -0,0 +1,199 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Compares the cost of an element Jacobian fill with the Sacado FAD types
+// Albany can be built with: DFad (default), SLFad (ENABLE_SLFAD) and
+// exact-size SFad (ENABLE_SFAD). The kernels mimic the gather, gradient
+// interpolation, flux and residual evaluators of
+//   - heat:      bilinear quad, 1 equation,  4 QPs  ->  4 derivatives
+//   - mechanics: trilinear hex, 3 equations, 8 QPs  -> 24 derivatives
+//
+// usage: FadFillBenchmark [number of cells] [repetitions]
+
+#include "Sacado_Fad_DFad.hpp"
+#include "Sacado_Fad_SFad.hpp"
+#include "Sacado_Fad_SLFad.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Same default as SLFAD_SIZE in the Albany configuration
+int const slfad_size = 32;
+
+// Synthetic, cell-independent basis data. Only the amount of arithmetic
+// matters here, not the values.
+struct Basis
+{
+  int num_nodes, num_qps, num_dims;
+  std::vector<double> grad_bf;   // (node, qp, dim)
+  std::vector<double> w_grad_bf; // (node, qp, dim)
+
+  Basis(int nodes, int qps, int dims)
+      : num_nodes(nodes), num_qps(qps), num_dims(dims),
+        grad_bf(nodes * qps * dims), w_grad_bf(nodes * qps * dims)
+  {
+    for (std::size_t i = 0; i < grad_bf.size(); ++i) {
+      grad_bf[i]   = 0.25 * ((i % 3) - 1.0) + 0.01 * i;
+      w_grad_bf[i] = 0.125 * grad_bf[i];
+    }
+  }
+
+  double grad(int node, int qp, int dim) const
+  {
+    return grad_bf[(node * num_qps + qp) * num_dims + dim];
+  }
+  double wgrad(int node, int qp, int dim) const
+  {
+    return w_grad_bf[(node * num_qps + qp) * num_dims + dim];
+  }
+};
+
+// Heat: T at nodes -> grad T at QPs -> flux k*grad T -> residual.
+template <typename ScalarT>
+double heatFill(Basis const& b, int num_cells)
+{
+  int const num_derivs = b.num_nodes;
+  double const k = 2.0;
+  std::vector<ScalarT> T(b.num_nodes);
+  std::vector<ScalarT> flux(b.num_qps * b.num_dims);
+  double check = 0.0;
+
+  for (int cell = 0; cell < num_cells; ++cell) {
+    // Gather solution
+    for (int node = 0; node < b.num_nodes; ++node)
+      T[node] = ScalarT(num_derivs, node, 1.0 + 0.001 * (cell + node));
+
+    // Gradient interpolation and flux
+    for (int qp = 0; qp < b.num_qps; ++qp)
+      for (int dim = 0; dim < b.num_dims; ++dim) {
+        ScalarT& f = flux[qp * b.num_dims + dim];
+        f = 0.0;
+        for (int node = 0; node < b.num_nodes; ++node)
+          f += T[node] * b.grad(node, qp, dim);
+        f *= k;
+      }
+
+    // Residual
+    for (int node = 0; node < b.num_nodes; ++node) {
+      ScalarT r = 0.0;
+      for (int qp = 0; qp < b.num_qps; ++qp)
+        for (int dim = 0; dim < b.num_dims; ++dim)
+          r += flux[qp * b.num_dims + dim] * b.wgrad(node, qp, dim);
+      check += r.dx(0);
+    }
+  }
+  return check;
+}
+
+// Mechanics: u at nodes -> grad u -> small strain -> linear elastic
+// stress -> residual.
+template <typename ScalarT>
+double mechanicsFill(Basis const& b, int num_cells)
+{
+  int const dims       = b.num_dims;
+  int const num_derivs = b.num_nodes * dims;
+  double const lambda = 1.0, mu = 0.5;
+  std::vector<ScalarT> u(b.num_nodes * dims);
+  std::vector<ScalarT> stress(b.num_qps * dims * dims);
+  std::vector<ScalarT> grad_u(dims * dims);
+  double check = 0.0;
+
+  for (int cell = 0; cell < num_cells; ++cell) {
+    // Gather solution
+    for (int node = 0; node < b.num_nodes; ++node)
+      for (int i = 0; i < dims; ++i)
+        u[node * dims + i] = ScalarT(
+            num_derivs, node * dims + i, 0.001 * (cell + node + i));
+
+    for (int qp = 0; qp < b.num_qps; ++qp) {
+      // Gradient interpolation
+      for (int i = 0; i < dims; ++i)
+        for (int j = 0; j < dims; ++j) {
+          ScalarT& g = grad_u[i * dims + j];
+          g = 0.0;
+          for (int node = 0; node < b.num_nodes; ++node)
+            g += u[node * dims + i] * b.grad(node, qp, j);
+        }
+
+      // Strain and stress
+      ScalarT trace = 0.0;
+      for (int i = 0; i < dims; ++i) trace += grad_u[i * dims + i];
+      for (int i = 0; i < dims; ++i)
+        for (int j = 0; j < dims; ++j) {
+          ScalarT& s = stress[(qp * dims + i) * dims + j];
+          s = mu * (grad_u[i * dims + j] + grad_u[j * dims + i]);
+          if (i == j) s += lambda * trace;
+        }
+    }
+
+    // Residual
+    for (int node = 0; node < b.num_nodes; ++node)
+      for (int i = 0; i < dims; ++i) {
+        ScalarT r = 0.0;
+        for (int qp = 0; qp < b.num_qps; ++qp)
+          for (int j = 0; j < dims; ++j)
+            r += stress[(qp * dims + i) * dims + j] * b.wgrad(node, qp, j);
+        check += r.dx(0);
+      }
+  }
+  return check;
+}
+
+template <typename Fill>
+void timeFill(std::string const& name, Fill fill, Basis const& b,
+              int num_cells, int reps)
+{
+  double check = 0.0;
+  auto const start = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < reps; ++rep) check += fill(b, num_cells);
+  auto const stop = std::chrono::steady_clock::now();
+
+  double const seconds = std::chrono::duration<double>(stop - start).count();
+  std::cout << "  " << std::left << std::setw(12) << name << std::right
+            << std::setw(12) << std::setprecision(4) << std::fixed
+            << seconds << " s   " << std::setw(10) << std::setprecision(1)
+            << 1.0e9 * seconds / (double(num_cells) * reps) << " ns/cell"
+            << "   (check " << std::scientific << std::setprecision(3)
+            << check << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  int const num_cells = argc > 1 ? std::atoi(argv[1]) : 100000;
+  int const reps      = argc > 2 ? std::atoi(argv[2]) : 5;
+
+  std::cout << "Jacobian fill, " << num_cells << " cells x " << reps
+            << " repetitions" << std::endl;
+
+  Basis const quad4(4, 4, 2);
+  std::cout << "Heat (Quad4, 1 eq, 4 derivatives):" << std::endl;
+  timeFill("DFad", heatFill<Sacado::Fad::DFad<double>>, quad4, num_cells,
+           reps);
+  timeFill("SLFad<32>", heatFill<Sacado::Fad::SLFad<double, slfad_size>>,
+           quad4, num_cells, reps);
+  timeFill("SFad<4>", heatFill<Sacado::Fad::SFad<double, 4>>, quad4,
+           num_cells, reps);
+
+  Basis const hex8(8, 8, 3);
+  std::cout << "Mechanics (Hex8, 3 eqs, 24 derivatives):" << std::endl;
+  timeFill("DFad", mechanicsFill<Sacado::Fad::DFad<double>>, hex8,
+           num_cells, reps);
+  timeFill("SLFad<32>", mechanicsFill<Sacado::Fad::SLFad<double, slfad_size>>,
+           hex8, num_cells, reps);
+  timeFill("SFad<24>", mechanicsFill<Sacado::Fad::SFad<double, 24>>, hex8,
+           num_cells, reps);
+
+  return 0;
+}
@@ -0,0 +1,424 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Startup cost of reading a Gmsh mesh in GmshSTKMeshStruct. Writes a box of
+// n^3 cubes, each split in 6 tetrahedra, with its boundary triangles, in the
+// ASCII and binary 2.2 and 4.1 formats, and times Albany::readGmshMesh on
+// each file, next to the getline/stringstream two-pass scan the reader
+// replaced. The default n = 80 gives 3.07 million tetrahedra. All files must
+// give the same mesh, otherwise the benchmark fails.
+//
+// usage: GmshReadBenchmark [n] [directory for the mesh files]
+
+#include "Albany_GmshReader.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BoxMesh
+{
+  std::vector<double> coords;
+  std::vector<int>    tetra;        // 4 nodes per tetrahedron
+  std::vector<int>    trias;        // 3 nodes per triangle
+  std::vector<int>    trias_face;   // boundary face (1..6) of each triangle
+};
+
+// Physical tag of the volume; the boundary faces get tags 1..6
+int const volume_tag = 100;
+
+BoxMesh
+buildBox(int const n)
+{
+  BoxMesh    m;
+  int const  np = n + 1;
+  auto const id = [np](int i, int j, int k) { return 1 + i + np * (j + np * k); };
+
+  m.coords.reserve(3 * np * np * np);
+  for (int k = 0; k < np; ++k)
+    for (int j = 0; j < np; ++j)
+      for (int i = 0; i < np; ++i) {
+        m.coords.push_back(double(i) / n);
+        m.coords.push_back(double(j) / n);
+        m.coords.push_back(double(k) / n);
+      }
+
+  // Kuhn subdivision of each cube along the diagonal v0-v6
+  int const paths[6][2] = {{1, 2}, {1, 5}, {3, 2}, {3, 7}, {4, 5}, {4, 7}};
+  int const corner[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+                            {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+  m.tetra.reserve(24 * n * n * n);
+  for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) {
+        int v[8];
+        for (int c = 0; c < 8; ++c)
+          v[c] = id(i + corner[c][0], j + corner[c][1], k + corner[c][2]);
+        for (auto const& p : paths) {
+          m.tetra.push_back(v[0]);
+          m.tetra.push_back(v[p[0]]);
+          m.tetra.push_back(v[p[1]]);
+          m.tetra.push_back(v[6]);
+        }
+      }
+
+  auto const square = [&m](int a, int b, int c, int d, int face) {
+    int const t[6] = {a, b, c, a, c, d};
+    m.trias.insert(m.trias.end(), t, t + 6);
+    m.trias_face.push_back(face);
+    m.trias_face.push_back(face);
+  };
+  // Two triangles per boundary square, face by face as Gmsh lists them
+  for (int face = 1; face <= 6; ++face)
+    for (int b = 0; b < n; ++b)
+      for (int a = 0; a < n; ++a) {
+        int const c = (face % 2) ? 0 : n;
+        switch (face) {
+          case 1:
+          case 2:
+            square(id(a, b, c), id(a + 1, b, c), id(a + 1, b + 1, c), id(a, b + 1, c), face);
+            break;
+          case 3:
+          case 4:
+            square(id(a, c, b), id(a + 1, c, b), id(a + 1, c, b + 1), id(a, c, b + 1), face);
+            break;
+          default:
+            square(id(c, a, b), id(c, a + 1, b), id(c, a + 1, b + 1), id(c, a, b + 1), face);
+        }
+      }
+  return m;
+}
+
+template <typename T>
+void
+put(std::ofstream& out, T const value)
+{
+  out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+void
+write22(BoxMesh const& m, std::string const& fname, bool const binary)
+{
+  std::ofstream out(fname.c_str(), std::ios::binary);
+  out << std::setprecision(17);
+  out << "$MeshFormat\n2.2 " << (binary ? 1 : 0) << " 8\n";
+  if (binary) {
+    put<int>(out, 1);
+    out << "\n";
+  }
+  out << "$EndMeshFormat\n";
+
+  std::size_t const num_nodes = m.coords.size() / 3;
+  out << "$Nodes\n" << num_nodes << "\n";
+  for (std::size_t i = 0; i < num_nodes; ++i) {
+    if (binary) {
+      put<int>(out, i + 1);
+      for (int d = 0; d < 3; ++d) put<double>(out, m.coords[3 * i + d]);
+    } else {
+      out << i + 1 << " " << m.coords[3 * i] << " " << m.coords[3 * i + 1]
+          << " " << m.coords[3 * i + 2] << "\n";
+    }
+  }
+  if (binary) out << "\n";
+  out << "$EndNodes\n";
+
+  std::size_t const num_trias = m.trias_face.size();
+  std::size_t const num_tetra = m.tetra.size() / 4;
+  out << "$Elements\n" << num_trias + num_tetra << "\n";
+  if (binary) {
+    put<int>(out, 2);
+    put<int>(out, num_trias);
+    put<int>(out, 2);
+    for (std::size_t e = 0; e < num_trias; ++e) {
+      put<int>(out, e + 1);
+      put<int>(out, m.trias_face[e]);
+      put<int>(out, m.trias_face[e]);
+      for (int k = 0; k < 3; ++k) put<int>(out, m.trias[3 * e + k]);
+    }
+    put<int>(out, 4);
+    put<int>(out, num_tetra);
+    put<int>(out, 2);
+    for (std::size_t e = 0; e < num_tetra; ++e) {
+      put<int>(out, num_trias + e + 1);
+      put<int>(out, volume_tag);
+      put<int>(out, 1);
+      for (int k = 0; k < 4; ++k) put<int>(out, m.tetra[4 * e + k]);
+    }
+    out << "\n";
+  } else {
+    for (std::size_t e = 0; e < num_trias; ++e)
+      out << e + 1 << " 2 2 " << m.trias_face[e] << " " << m.trias_face[e]
+          << " " << m.trias[3 * e] << " " << m.trias[3 * e + 1] << " "
+          << m.trias[3 * e + 2] << "\n";
+    for (std::size_t e = 0; e < num_tetra; ++e)
+      out << num_trias + e + 1 << " 4 2 " << volume_tag << " 1 "
+          << m.tetra[4 * e] << " " << m.tetra[4 * e + 1] << " "
+          << m.tetra[4 * e + 2] << " " << m.tetra[4 * e + 3] << "\n";
+  }
+  out << "$EndElements\n";
+}
+
+void
+write41(BoxMesh const& m, std::string const& fname, bool const binary)
+{
+  std::ofstream out(fname.c_str(), std::ios::binary);
+  out << std::setprecision(17);
+  out << "$MeshFormat\n4.1 " << (binary ? 1 : 0) << " 8\n";
+  if (binary) {
+    put<int>(out, 1);
+    out << "\n";
+  }
+  out << "$EndMeshFormat\n";
+
+  // Six surfaces with physical tags 1..6 and one volume with volume_tag
+  out << "$Entities\n";
+  if (binary) {
+    put<std::uint64_t>(out, 0);
+    put<std::uint64_t>(out, 0);
+    put<std::uint64_t>(out, 6);
+    put<std::uint64_t>(out, 1);
+    for (int s = 1; s <= 6; ++s) {
+      put<int>(out, s);
+      for (int k = 0; k < 6; ++k) put<double>(out, k < 3 ? 0.0 : 1.0);
+      put<std::uint64_t>(out, 1);
+      put<int>(out, s);
+      put<std::uint64_t>(out, 0);
+    }
+    put<int>(out, 1);
+    for (int k = 0; k < 6; ++k) put<double>(out, k < 3 ? 0.0 : 1.0);
+    put<std::uint64_t>(out, 1);
+    put<int>(out, volume_tag);
+    put<std::uint64_t>(out, 6);
+    for (int s = 1; s <= 6; ++s) put<int>(out, s);
+    out << "\n";
+  } else {
+    out << "0 0 6 1\n";
+    for (int s = 1; s <= 6; ++s) out << s << " 0 0 0 1 1 1 1 " << s << " 0\n";
+    out << "1 0 0 0 1 1 1 1 " << volume_tag << " 6 1 2 3 4 5 6\n";
+  }
+  out << "$EndEntities\n";
+
+  std::size_t const num_nodes = m.coords.size() / 3;
+  out << "$Nodes\n";
+  if (binary) {
+    put<std::uint64_t>(out, 1);
+    put<std::uint64_t>(out, num_nodes);
+    put<std::uint64_t>(out, 1);
+    put<std::uint64_t>(out, num_nodes);
+    put<int>(out, 3);
+    put<int>(out, 1);
+    put<int>(out, 0);
+    put<std::uint64_t>(out, num_nodes);
+    for (std::size_t i = 0; i < num_nodes; ++i) put<std::uint64_t>(out, i + 1);
+    out.write(reinterpret_cast<char const*>(m.coords.data()),
+              m.coords.size() * sizeof(double));
+    out << "\n";
+  } else {
+    out << "1 " << num_nodes << " 1 " << num_nodes << "\n";
+    out << "3 1 0 " << num_nodes << "\n";
+    for (std::size_t i = 0; i < num_nodes; ++i) out << i + 1 << "\n";
+    for (std::size_t i = 0; i < num_nodes; ++i)
+      out << m.coords[3 * i] << " " << m.coords[3 * i + 1] << " "
+          << m.coords[3 * i + 2] << "\n";
+  }
+  out << "$EndNodes\n";
+
+  // One block per boundary face, then the tetrahedra
+  std::size_t const num_trias = m.trias_face.size();
+  std::size_t const num_tetra = m.tetra.size() / 4;
+  std::size_t const total     = num_trias + num_tetra;
+  out << "$Elements\n";
+  if (binary) {
+    put<std::uint64_t>(out, 7);
+    put<std::uint64_t>(out, total);
+    put<std::uint64_t>(out, 1);
+    put<std::uint64_t>(out, total);
+  } else {
+    out << "7 " << total << " 1 " << total << "\n";
+  }
+  std::size_t tag = 1;
+  for (int s = 1; s <= 6; ++s) {
+    std::size_t count = 0;
+    for (std::size_t e = 0; e < num_trias; ++e) count += m.trias_face[e] == s;
+    if (binary) {
+      put<int>(out, 2);
+      put<int>(out, s);
+      put<int>(out, 2);
+      put<std::uint64_t>(out, count);
+    } else {
+      out << "2 " << s << " 2 " << count << "\n";
+    }
+    for (std::size_t e = 0; e < num_trias; ++e) {
+      if (m.trias_face[e] != s) continue;
+      if (binary) {
+        put<std::uint64_t>(out, tag++);
+        for (int k = 0; k < 3; ++k) put<std::uint64_t>(out, m.trias[3 * e + k]);
+      } else {
+        out << tag++ << " " << m.trias[3 * e] << " " << m.trias[3 * e + 1]
+            << " " << m.trias[3 * e + 2] << "\n";
+      }
+    }
+  }
+  if (binary) {
+    put<int>(out, 3);
+    put<int>(out, 1);
+    put<int>(out, 4);
+    put<std::uint64_t>(out, num_tetra);
+  } else {
+    out << "3 1 4 " << num_tetra << "\n";
+  }
+  for (std::size_t e = 0; e < num_tetra; ++e) {
+    if (binary) {
+      put<std::uint64_t>(out, tag++);
+      for (int k = 0; k < 4; ++k) put<std::uint64_t>(out, m.tetra[4 * e + k]);
+    } else {
+      out << tag++ << " " << m.tetra[4 * e] << " " << m.tetra[4 * e + 1] << " "
+          << m.tetra[4 * e + 2] << " " << m.tetra[4 * e + 3] << "\n";
+    }
+  }
+  if (binary) out << "\n";
+  out << "$EndElements\n";
+}
+
+// The scan GmshSTKMeshStruct used to do on ASCII 2.2 files: getline and
+// stringstream for every line, counting the element types in a first pass
+// over the element section and filling the arrays in a second one.
+std::size_t
+legacyScan(std::string const& fname)
+{
+  std::ifstream ifile(fname.c_str());
+  std::string   line;
+  while (std::getline(ifile, line) && line != "$Nodes") {}
+  std::getline(ifile, line);
+  int const           num_nodes = std::atoi(line.c_str());
+  std::vector<double> pts(3 * num_nodes);
+  int                 id;
+  for (int i = 0; i < num_nodes; ++i)
+    ifile >> id >> pts[3 * i] >> pts[3 * i + 1] >> pts[3 * i + 2];
+
+  while (std::getline(ifile, line) && line != "$Elements") {}
+  std::getline(ifile, line);
+  int const            num_entities = std::atoi(line.c_str());
+  std::streampos const elements     = ifile.tellg();
+  int                  nb_tetra = 0, nb_tria = 0, e_type;
+  for (int i = 0; i < num_entities; ++i) {
+    std::getline(ifile, line);
+    std::stringstream ss(line);
+    ss >> id >> e_type;
+    nb_tetra += e_type == 4;
+    nb_tria += e_type == 2;
+  }
+
+  std::vector<int> tetra(5 * nb_tetra), trias(4 * nb_tria);
+  ifile.seekg(elements);
+  int ntags, tag, dummy, itetra = 0, itria = 0;
+  for (int i = 0; i < num_entities; ++i) {
+    std::getline(ifile, line);
+    std::stringstream ss(line);
+    ss >> id >> e_type >> ntags >> tag;
+    for (int k = 1; k < ntags; ++k) ss >> dummy;
+    if (e_type == 4) {
+      int* t = &tetra[5 * itetra++];
+      ss >> t[0] >> t[1] >> t[2] >> t[3];
+      t[4] = tag;
+    } else if (e_type == 2) {
+      int* t = &trias[4 * itria++];
+      ss >> t[0] >> t[1] >> t[2];
+      t[3] = tag;
+    }
+  }
+  return itetra + itria;
+}
+
+bool
+sameMesh(Albany::GmshMesh const& a, Albany::GmshMesh const& b)
+{
+  return a.coords == b.coords && a.tetra.nodes == b.tetra.nodes &&
+         a.tetra.tags == b.tetra.tags && a.trias.nodes == b.trias.nodes &&
+         a.trias.tags == b.trias.tags;
+}
+
+double
+seconds(std::chrono::steady_clock::time_point const start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int
+main(int argc, char* argv[])
+{
+  int const         n   = argc > 1 ? std::atoi(argv[1]) : 80;
+  std::string const dir = argc > 2 ? argv[2] : ".";
+
+  BoxMesh const box = buildBox(n);
+  std::cout << "Box of " << n << "^3 cubes: " << box.coords.size() / 3
+            << " nodes, " << box.tetra.size() / 4 << " tetrahedra, "
+            << box.trias_face.size() << " boundary triangles\n";
+
+  struct Format
+  {
+    char const* name;
+    double      version;
+    bool        binary;
+  };
+  Format const formats[] = {{"ascii22", 2.2, false},
+                            {"binary22", 2.2, true},
+                            {"ascii41", 4.1, false},
+                            {"binary41", 4.1, true}};
+
+  Albany::GmshMesh reference;
+  bool             ok = true;
+  std::cout << std::fixed << std::setprecision(3);
+  for (auto const& f : formats) {
+    std::string const fname = dir + "/GmshReadBenchmark_" + f.name + ".msh";
+    if (f.version < 3)
+      write22(box, fname, f.binary);
+    else
+      write41(box, fname, f.binary);
+
+    if (!f.binary && f.version < 3) {
+      auto const        start = std::chrono::steady_clock::now();
+      std::size_t const count = legacyScan(fname);
+      std::cout << std::setw(10) << f.name << "  getline two-pass  "
+                << seconds(start) << " s  (" << count << " elements)\n";
+    }
+
+    Albany::GmshMesh mesh;
+    auto const       start = std::chrono::steady_clock::now();
+    Albany::readGmshMesh(fname, mesh);
+    std::cout << std::setw(10) << f.name << "  readGmshMesh      "
+              << seconds(start) << " s\n";
+
+    if (&f == formats) {
+      reference = mesh;
+      ok = ok && reference.tetra.size() == box.tetra.size() / 4 &&
+           reference.tetra.tags[0] == volume_tag &&
+           reference.trias.size() == box.trias_face.size();
+    } else if (!sameMesh(reference, mesh)) {
+      std::cout << "  mesh read from " << fname << " differs\n";
+      ok = false;
+    }
+    std::remove(fname.c_str());
+  }
+
+  if (!ok) {
+    std::cout << "FAILED\n";
+    return 1;
+  }
+  return 0;
+}
@@ -45,6 +45,16 @@ public:
   
   pointer_type operator[] (const key_type &item);
 
+  //! All monitored items, sorted by name
+  const monitor_map& items () const {
+    return itemMap_;
+  }
+
+  //! Stop monitoring an item
+  void remove (const key_type &item) {
+    itemMap_.erase(item);
+  }
+
   void summarize (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
                   std::ostream &out = std::cout);
 
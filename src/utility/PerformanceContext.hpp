@@ -17,6 +17,7 @@
 
 #include "TimeMonitor.hpp"
 #include "CounterMonitor.hpp"
+#include "EvaluatorMonitor.hpp"
 #include "VariableMonitor.hpp"
 
 namespace util {
@@ -40,6 +41,10 @@ public:
   VariableMonitor& variableMonitor () {
     return variableMonitor_;
   }
+
+  EvaluatorMonitor& evaluatorMonitor () {
+    return evaluatorMonitor_;
+  }
   
 private:
   
@@ -48,6 +53,7 @@ private:
   TimeMonitor     timeMonitor_;
   CounterMonitor  counterMonitor_;
   VariableMonitor variableMonitor_;
+  EvaluatorMonitor evaluatorMonitor_;
 };
 }
 
@@ -0,0 +1,89 @@
+#! /usr/bin/env python
+import sys
+import os
+import re
+import time
+
+from subprocess import Popen
+
+# Runs the same problem with multiplicative and additive Schwarz and
+# compares Schwarz iteration counts and wall time. The additive problem is
+# run again with the subdomains solved concurrently, which must give the
+# same iterations.
+
+result = 0
+
+def run(name, input_file):
+    log_file_name = name + ".log"
+
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+
+    logfile = open(log_file_name, 'w')
+
+    command = ["./AlbanyT", input_file]
+    start = time.time()
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    wall_time = time.time() - start
+    logfile.close()
+
+    converged = True
+    steps = 0
+    iterations = 0
+    concurrent = True
+
+    for line in open(log_file_name):
+        if "Concurrent Subdomain Solves disabled" in line:
+            concurrent = False
+        if "Schwarz Alternating Method converged: NO" in line:
+            converged = False
+        if "Schwarz Alternating Method converged: YES" in line:
+            steps = steps + 1
+        match = re.match(r"Total iterations\s*:\s*(\d+)", line)
+        if match:
+            iterations = iterations + int(match.group(1))
+
+    if steps == 0:
+        converged = False
+
+    return return_code, converged, steps, iterations, wall_time, concurrent
+
+print "test 1 - Schwarz Alternating, multiplicative"
+mult = run("cuboid_multiplicative", "cuboids.yaml")
+
+print "test 2 - Schwarz Alternating, additive"
+add = run("cuboid_additive", "cuboids_additive.yaml")
+
+print "test 3 - Schwarz Alternating, additive, concurrent subdomain solves"
+conc = run("cuboid_concurrent", "cuboids_concurrent.yaml")
+
+for name, (return_code, converged, steps, iterations, wall_time, _) in \
+        [("multiplicative", mult), ("additive", add), ("concurrent", conc)]:
+    print "%-15s converged: %s steps: %d iterations: %d wall time: %.2f s" % \
+        (name, converged, steps, iterations, wall_time)
+    if return_code != 0:
+        result = result + return_code
+    if converged == False:
+        result = result + 1
+
+# With two subdomains additive Schwarz needs at most about twice the
+# iterations of the multiplicative method.
+if add[3] > 2 * mult[3] + add[2]:
+    print "additive Schwarz took too many iterations"
+    result = result + 1
+
+# The subdomain solves of one iteration are independent, so solving them
+# concurrently must not change the iterations.
+if conc[2] != add[2] or conc[3] != add[3]:
+    print "concurrent additive Schwarz differs from the serial one"
+    result = result + 1
+
+if conc[5] == False:
+    print "concurrent subdomain solves unavailable, solved serially"
+
+if result != 0:
+    print "result is %s" % result
+    print "cuboid additive test has failed"
+
+sys.exit(result)
@@ -0,0 +1,53 @@
+#! /usr/bin/env python
+#
+# Runs the 3D J2 traction problem with "Frozen Element Jacobians". The run
+# checks the regression value of the problem without frozen elements. The
+# load stays below the yield strength in most steps, so J2Model flags the
+# cells unchanged and the later Newton iterations of a step reuse their
+# element matrices. Fails unless the Jacobian fills report both reused and
+# recomputed cells.
+
+import sys
+import os
+import re
+from subprocess import Popen
+
+result = 0
+
+name = "PlasticityJ2_3D_Traction_FrozenElements"
+log_file_name = name + ".log"
+if os.path.exists(log_file_name):
+    os.remove(log_file_name)
+logfile = open(log_file_name, 'w')
+
+# run AlbanyT
+command = ["./AlbanyT", name + ".yaml"]
+p = Popen(command, stdout=logfile, stderr=logfile)
+return_code = p.wait()
+logfile.close()
+if return_code != 0:
+    result = return_code
+
+with open(log_file_name, 'r') as log_file:
+    log = log_file.read()
+print(log)
+
+# One line per Jacobian fill
+fills = re.findall(r"Frozen elements: (\d+) reused, (\d+) recomputed", log)
+reused = sum(int(fill[0]) for fill in fills)
+recomputed = sum(int(fill[1]) for fill in fills)
+print("%d Jacobian fills, %d cells reused, %d cells recomputed" %
+      (len(fills), reused, recomputed))
+
+if reused == 0:
+    print("no element matrix was reused")
+    result = result + 1
+if recomputed == 0:
+    print("no element matrix was recomputed")
+    result = result + 1
+
+if result != 0:
+    print("result is %s" % result)
+    print("%s test has failed" % name)
+
+sys.exit(result)
@@ -0,0 +1,71 @@
+#! /usr/bin/env python
+#
+# Runs the 2D transient heat problem with AlbanyT, collecting the snapshots
+# into a streaming SVD basis, then reads the basis back from basis.mtx and
+# fails unless it has one row per degree of freedom, between 1 and "Basis
+# Size" columns, and orthonormal columns. The run checks its own regression
+# values.
+
+import sys
+import os
+from subprocess import Popen
+
+name = "input_tpetra"
+basis_file_name = "basis.mtx"
+num_dofs = 61 * 61
+basis_size = 8
+tolerance = 1.0e-8
+
+def read_matrix_market_array(file_name):
+    # Dense "array" format: comment lines, "rows cols", then the values
+    # column by column
+    with open(file_name, 'r') as f:
+        lines = [l for l in f if not l.startswith('%') and l.strip()]
+    rows, cols = [int(v) for v in lines[0].split()[:2]]
+    values = [float(v) for l in lines[1:] for v in l.split()]
+    if len(values) != rows * cols:
+        return rows, cols, None
+    return rows, cols, [values[j * rows:(j + 1) * rows] for j in range(cols)]
+
+result = 0
+
+log_file_name = name + ".log"
+for file_name in [log_file_name, basis_file_name]:
+    if os.path.exists(file_name):
+        os.remove(file_name)
+logfile = open(log_file_name, 'w')
+p = Popen(["./AlbanyT", name + ".xml"], stdout=logfile, stderr=logfile)
+return_code = p.wait()
+logfile.close()
+with open(log_file_name, 'r') as log_file:
+    print(log_file.read())
+if return_code != 0:
+    result = return_code
+
+if result == 0 and not os.path.exists(basis_file_name):
+    print("%s not written" % basis_file_name)
+    result = 1
+
+if result == 0:
+    rows, cols, columns = read_matrix_market_array(basis_file_name)
+    print("basis: %d rows, %d columns" % (rows, cols))
+    if columns is None:
+        print("%s does not hold %d values" % (basis_file_name, rows * cols))
+        result = 1
+    elif rows != num_dofs or cols < 1 or cols > basis_size:
+        print("expected %d rows and 1 to %d columns" % (num_dofs, basis_size))
+        result = 1
+    else:
+        for i in range(cols):
+            for j in range(i + 1):
+                dot = sum(a * b for a, b in zip(columns[i], columns[j]))
+                expected = 1.0 if i == j else 0.0
+                if abs(dot - expected) > tolerance:
+                    print("columns %d and %d: inner product %g" % (i, j, dot))
+                    result = result + 1
+
+if result != 0:
+    print("result is %s" % result)
+    print("MOR_StreamingBasisTpetra test has failed")
+
+sys.exit(result)
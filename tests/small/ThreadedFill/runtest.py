@@ -0,0 +1,72 @@
+#! /usr/bin/env python
+#
+# Runs the 3D heat problem with the serial fill and with 4 fill threads.
+# Both runs check their regression values. The speedup of the residual and
+# Jacobian fills is reported but not asserted: the mesh is too small for
+# reliable timings. tests/large/PerformanceTests/ThreadedFill asserts it.
+
+import sys
+import os
+import re
+
+from subprocess import Popen
+
+num_threads = 4
+timers = ["> Albany Fill: Residual", "> Albany Fill: Jacobian"]
+
+def run(name):
+    log_file_name = name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    env = dict(os.environ)
+    env["OMP_NUM_THREADS"] = str(num_threads)
+    logfile = open(log_file_name, 'w')
+    p = Popen(["./AlbanyT", name + ".xml"], stdout=logfile, stderr=logfile,
+              env=env)
+    return_code = p.wait()
+    logfile.close()
+    with open(log_file_name, 'r') as log_file:
+        log = log_file.read()
+    print(log)
+    return return_code, log
+
+def fill_times(log):
+    # First column of the TimeMonitor summary: the time on the fastest rank
+    times = {}
+    for timer in timers:
+        match = re.search("^" + re.escape(timer) + r"\s+([0-9.eE+-]+)", log,
+                          re.MULTILINE)
+        if match:
+            times[timer] = float(match.group(1))
+    return times
+
+result = 0
+
+print("test 1 - serial fill")
+return_code, serial_log = run("inputT_1thread")
+if return_code != 0:
+    result = return_code
+
+print("test 2 - %d fill threads" % num_threads)
+return_code, threaded_log = run("inputT_%dthreads" % num_threads)
+if return_code != 0:
+    result = return_code
+
+if result != 0:
+    print("result is %s" % result)
+    print("ThreadedFill test has failed")
+    sys.exit(result)
+
+serial_times = fill_times(serial_log)
+threaded_times = fill_times(threaded_log)
+
+for timer in timers:
+    if timer not in serial_times or timer not in threaded_times:
+        print("timer '%s' not found in the output" % timer)
+        continue
+    speedup = serial_times[timer] / max(threaded_times[timer], 1.0e-12)
+    print("%s: %g s serial, %g s with %d threads, speedup %.2f" %
+          (timer, serial_times[timer], threaded_times[timer], num_threads,
+           speedup))
+
+sys.exit(result)